@@ -1 +1,2 @@
 from animator.anim import easing as easing
+from animator.anim.timeline import Timeline as Timeline
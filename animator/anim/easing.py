@@ -9,6 +9,14 @@ All easing functions take a single argument, `t`, which is usually a value betwe
 between 0 and 1, which is the progress of the animation. Some easing functions may return values outside of this range,
 for example, `bounce`.
 
+The built-in easing functions are native :class:`skia.Easing` objects. Besides a single float, they can also be called
+with a numpy array of any shape to ease all the values in one call, for example, the progress of many tweens at once.
+Scalar arguments, including numpy scalars, return a Python float.
+
+.. note::
+    The native functions compute in single (float32) precision, while the earlier pure Python functions used double
+    precision. Results can differ from those in about the seventh significant digit.
+
 .. plot::
 
     import animator as am
@@ -22,258 +30,99 @@ for example, `bounce`.
     axs[0, 1].set_title("out", size='xx-large')
     axs[0, 2].set_title("inout", size='xx-large')
     for i, func in enumerate(funcs):
-        axs[i, 0].plot(x, np.vectorize(getattr(am.easing, func + "_in"))(x))
-        axs[i, 1].plot(x, np.vectorize(getattr(am.easing, func + "_out"))(x))
-        axs[i, 2].plot(x, np.vectorize(getattr(am.easing, func + "_inout"))(x))
+        axs[i, 0].plot(x, getattr(am.easing, func + "_in")(x))
+        axs[i, 1].plot(x, getattr(am.easing, func + "_out")(x))
+        axs[i, 2].plot(x, getattr(am.easing, func + "_inout")(x))
     plt.tight_layout()
     plt.show()
 """
-import math
 from re import X
 from typing import Callable
 
-_HALF_PI = math.pi / 2
-_PI = math.pi
-_TWO_PI = math.tau
-
-
-def linear(t: float) -> float:
-    """Linear easing function, the input is the output. :math:`f(t) = t`"""
-    return t
-
-
-def sin_in(t: float) -> float:
-    """Sinusoidal in. :math:`f(t) = \\sin(t)`"""
-    return 1 - math.cos(t * _HALF_PI)
-
-
-def sin_out(t: float) -> float:
-    """Sinusoidal out. :math:`f(t) = \\sin(t)`"""
-    return math.sin(t * _HALF_PI)
-
-
-def sin_inout(t: float) -> float:
-    """Sinusoidal in-out. :math:`f(t) = \\sin(t)`"""
-    return (1 - math.cos(t * _PI)) * 0.5
-
-
-def circ_in(t: float) -> float:
-    """Circular in for a quarter circle. :math:`f(t) = \\sqrt{1 - t^2}`"""
-    return 1 - math.sqrt(1 - t * t)
-
-
-def circ_out(t: float) -> float:
-    """Circular out for a quarter circle. :math:`f(t) = \\sqrt{1 - t^2}`"""
-    return math.sqrt(t * (2 - t))
-
-
-def circ_inout(t: float) -> float:
-    """Circular in-out for a semi-circle. :math:`f(t) = \\sqrt{1 - t^2}`"""
-    t *= 2
-    if t < 1:
-        return (1 - math.sqrt(1 - t * t)) * 0.5
-    t -= 2
-    return (1 + math.sqrt(1 - t * t)) * 0.5
-
-
-def exp_in(t: float) -> float:
-    """Exponential in. :math:`f(t) = 2^t`"""
-    return 2 ** (10 * (t - 1))
-
-
-def exp_out(t: float) -> float:
-    """Exponential out. :math:`f(t) = 2^t`"""
-    return 1 - 2 ** (-10 * t)
+from animator import skia
 
+_Type = skia.Easing.Type
 
-def exp_inout(t: float) -> float:
-    """Exponential in-out. :math:`f(t) = 2^t`"""
-    t *= 2
-    if t < 1:
-        return 2 ** (10 * t - 11)
-    return 1 - 2 ** (9 - 10 * t)
+linear = skia.Easing(_Type.kLinear)  #: Linear easing function, the input is the output. :math:`f(t) = t`
+sin_in = skia.Easing(_Type.kSinIn)  #: Sinusoidal in. :math:`f(t) = \sin(t)`
+sin_out = skia.Easing(_Type.kSinOut)  #: Sinusoidal out. :math:`f(t) = \sin(t)`
+sin_inout = skia.Easing(_Type.kSinInOut)  #: Sinusoidal in-out. :math:`f(t) = \sin(t)`
+circ_in = skia.Easing(_Type.kCircIn)  #: Circular in for a quarter circle. :math:`f(t) = \sqrt{1 - t^2}`
+circ_out = skia.Easing(_Type.kCircOut)  #: Circular out for a quarter circle. :math:`f(t) = \sqrt{1 - t^2}`
+circ_inout = skia.Easing(_Type.kCircInOut)  #: Circular in-out for a semi-circle. :math:`f(t) = \sqrt{1 - t^2}`
+exp_in = skia.Easing(_Type.kExpIn)  #: Exponential in. :math:`f(t) = 2^t`
+exp_out = skia.Easing(_Type.kExpOut)  #: Exponential out. :math:`f(t) = 2^t`
+exp_inout = skia.Easing(_Type.kExpInOut)  #: Exponential in-out. :math:`f(t) = 2^t`
+bounce_in = skia.Easing(_Type.kBounceIn)  #: Bounce in, amplitude of bounce increases.
+bounce_out = skia.Easing(_Type.kBounceOut)  #: Bounce out, amplitude of bounce decreases.
+bounce_inout = skia.Easing(_Type.kBounceInOut)  #: Bounce in-out, amplitude of bounce increases and then decreases.
 
 
-def bounce_in(t: float) -> float:
-    """Bounce in, amplitude of bounce increases."""
-    return 1 - bounce_out(1 - t)
-
-
-def bounce_out(t: float) -> float:
-    """Bounce out, amplitude of bounce decreases."""
-    if t < 1 / 2.75:
-        return 7.5625 * t * t
-    if t < 2 / 2.75:
-        return 7.5625 * (t - 1.5 / 2.75) ** 2 + 0.75
-    if t < 2.5 / 2.75:
-        return 7.5625 * (t - 2.25 / 2.75) ** 2 + 0.9375
-    return 7.5625 * (t - 2.625 / 2.75) ** 2 + 0.984375
-
-
-def bounce_inout(t: float) -> float:
-    """Bounce in-out, amplitude of bounce increases and then decreases."""
-    if t < 0.5:
-        return (1 - bounce_out(1 - 2 * t)) * 0.5
-    return (1 + bounce_out(2 * t - 1)) * 0.5
-
-
-def bezier(x1: float, y1: float, x2: float | None = None, y2: float | None = None, /) -> Callable[[float], float]:
+def bezier(x1: float, y1: float, x2: float | None = None, y2: float | None = None, /) -> skia.Easing:
     """
     Create a cubic bezier easing function from one or two control points. The curve starts at (0, 0) and ends at (1, 1).
+    The curve is solved natively with a precomputed table, so the returned function is cheap to evaluate, even over
+    arrays.
     """
     if x2 is None:
         x1 *= 2 / 3
         y1 *= 2 / 3
         x2 = x1 + 1 / 3
         y2 = y1 + 1 / 3
-    e = 1e-6
-
-    cx = 3 * x1
-    bx = 3 * (x2 - x1) - cx
-    ax = 1 - cx - bx
-    cy = 3 * y1
-    by = 3 * (y2 - y1) - cy  # type: ignore y2 will never be None
-    ay = 1 - cy - by
-
-    def X(t: float) -> float:
-        return ((ax * t + bx) * t + cx) * t
-
-    def X_inv(x: float) -> float:
-        t2 = x
-        for i in range(8):
-            x2 = X(t2) - x
-            if abs(x2) < e:
-                return t2
-            d = (3 * ax * t2 + 2 * bx) * t2 + cx
-            if abs(d) < e:
-                break
-            t2 -= x2 / d
-        t0 = 0
-        t1 = 1
-        t2 = x
-        if t2 < t0:
-            return t0
-        if t2 > t1:
-            return t1
-        while t0 < t1:
-            x2 = X(t2)
-            if abs(x2 - x) < e:
-                return t2
-            if x > x2:
-                t0 = t2
-            else:
-                t1 = t2
-            t2 = (t1 - t0) * 0.5 + t0
-        return t2
-
-    def f(t: float) -> float:
-        x = X_inv(t)
-        return ((ay * x + by) * x + cy) * x
-
-    return f
-
-
-def get_quadish(amount: float) -> Callable[[float], float]:
+    return skia.Easing.Bezier(x1, y1, x2, y2)  # type: ignore y2 will never be None
+
+
+def get_quadish(amount: float) -> skia.Easing:
     """
     Create a quadratic easing function with a given amount of ease. -1 is ease in, 0 is linear, 1 is ease out. Other
     values gives something in between.
     """
-    if amount < -1:
-        amount = -1
-    if amount > 1:
-        amount = 1
-    return lambda t: t * (1 + (1 - t) * amount)
+    return skia.Easing(_Type.kQuadish, amount)
 
 
-def get_pow_in(n: float) -> Callable[[float], float]:
+def get_pow_in(n: float) -> skia.Easing:
     """Create a power in easing function with power *n*. :math:`f(t) = t^n`"""
-    return lambda t: t**n
+    return skia.Easing(_Type.kPowIn, n)
 
 
-def get_pow_out(n: float) -> Callable[[float], float]:
+def get_pow_out(n: float) -> skia.Easing:
     """Create a power out easing function with power *n*. :math:`f(t) = t^n`"""
-    return lambda t: 1 - (1 - t) ** n
+    return skia.Easing(_Type.kPowOut, n)
 
 
-def get_pow_inout(n: float) -> Callable[[float], float]:
+def get_pow_inout(n: float) -> skia.Easing:
     """Create a power in-out easing function with power *n*. :math:`f(t) = t^n`"""
-
-    def f(t: float) -> float:
-        t *= 2
-        if t < 1:
-            return t**n * 0.5
-        return 1 - abs((2 - t) ** n) * 0.5
-
-    return f
+    return skia.Easing(_Type.kPowInOut, n)
 
 
-def get_back_in(amount: float) -> Callable[[float], float]:
+def get_back_in(amount: float) -> skia.Easing:
     """Create a back in easing function with a given amount of overshoot."""
-    return lambda t: t * t * ((amount + 1) * t - amount)
+    return skia.Easing(_Type.kBackIn, amount)
 
 
-def get_back_out(amount: float) -> Callable[[float], float]:
+def get_back_out(amount: float) -> skia.Easing:
     """Create a back out easing function with a given amount of overshoot."""
+    return skia.Easing(_Type.kBackOut, amount)
 
-    def f(t: float) -> float:
-        t -= 1
-        return t * t * ((amount + 1) * t + amount) + 1
 
-    return f
-
-
-def get_back_inout(amount: float) -> Callable[[float], float]:
+def get_back_inout(amount: float) -> skia.Easing:
     """Create a back in-out easing function with a given amount of overshoot."""
+    return skia.Easing(_Type.kBackInOut, amount)
 
-    def f(t: float) -> float:
-        t *= 2
-        if t < 1:
-            return t * t * ((amount + 1) * t - amount) * 0.5
-        t -= 2
-        return t * t * ((amount + 1) * t + amount) * 0.5 + 1
-
-    return f
 
-
-def get_elastic_in(amplitude: float, period: float) -> Callable[[float], float]:
+def get_elastic_in(amplitude: float, period: float) -> skia.Easing:
     """Create an elastic in easing function with a given amplitude and period."""
-    asin = math.asin(1 / amplitude)
-    period = _TWO_PI / period
-
-    def f(t: float) -> float:
-        if t == 0 or t == 1:
-            return t
-        t -= 1
-        return -amplitude * 2 ** (10 * t) * math.sin(t * period - asin)
+    return skia.Easing(_Type.kElasticIn, amplitude, period)
 
-    return f
 
-
-def get_elastic_out(amplitude: float, period: float) -> Callable[[float], float]:
+def get_elastic_out(amplitude: float, period: float) -> skia.Easing:
     """Create an elastic out easing function with a given amplitude and period."""
-    asin = math.asin(1 / amplitude)
-    period = _TWO_PI / period
-
-    def f(t: float) -> float:
-        if t == 0 or t == 1:
-            return t
-        return amplitude * 2 ** (-10 * t) * math.sin(t * period - asin) + 1
-
-    return f
+    return skia.Easing(_Type.kElasticOut, amplitude, period)
 
 
-def get_elastic_inout(amplitude: float, period: float) -> Callable[[float], float]:
+def get_elastic_inout(amplitude: float, period: float) -> skia.Easing:
     """Create an elastic in-out easing function with a given amplitude and period."""
-    asin = math.asin(1 / amplitude)
-    period = _TWO_PI / period
-
-    def f(t: float) -> float:
-        t = t * 2 - 1
-        if t < 0:
-            return -0.5 * amplitude * 2 ** (10 * t) * math.sin(t * period - asin)
-        return amplitude * 2 ** (-10 * t) * math.sin(t * period - asin) * 0.5 + 1
-
-    return f
+    return skia.Easing(_Type.kElasticInOut, amplitude, period)
 
 
 def repeat(f: Callable[[float], float]) -> Callable[[float], float]:
@@ -0,0 +1,99 @@
+"""Keyframe animation of properties, evaluated natively with :class:`skia.Timeline`."""
+from __future__ import annotations
+
+from typing import Any, Tuple, Union
+
+from animator import skia
+from animator.graphics.color import color
+
+Keyframe = Union[Tuple[float, Any], Tuple[float, Any, skia.Easing]]
+
+_TrackType = skia.Timeline.TrackType
+ColorSpace = skia.Timeline.ColorSpace
+
+
+def _track_type(value: Any) -> skia.Timeline.TrackType:
+    if isinstance(value, skia.Path):
+        return _TrackType.kPath
+    if isinstance(value, skia.Matrix):
+        return _TrackType.kMatrix
+    if isinstance(value, (skia.Color4f, str)):
+        return _TrackType.kColor
+    if isinstance(value, skia.Point):
+        return _TrackType.kPoint
+    if isinstance(value, (tuple, list)):
+        return _TrackType.kPoint if len(value) == 2 else _TrackType.kColor
+    return _TrackType.kScalar
+
+
+class Timeline:
+    """A set of keyframe tracks, each animating one property. All tracks are evaluated together in native code, and the
+    values are written to their properties by :meth:`apply`. The values only depend on the time, so a timeline can be
+    applied at any time, in any order, which allows rendering frames out of order or on multiple workers.
+
+    Add a timeline to :attr:`Scene.timelines` to apply it at the time of each frame before it is drawn.
+
+    Example::
+
+        timeline = Timeline()
+        timeline.add(circle, 'pos', (0, (100, 100)), (2, (400, 100), easing.quad_inout))
+        timeline.add(circle, 'r', (0, 10), (1, 50, easing.back_out))
+        timeline.add(circle.style.set_fill_color, None, (0, 'red'), (2, 'blue'), space=ColorSpace.kOKLab)
+        scene.timelines.append(timeline)
+    """
+
+    def __init__(self) -> None:
+        self.__timeline: skia.Timeline = skia.Timeline()
+        self.__targets: list[tuple[Any, str | None]] = []
+
+    @property
+    def duration(self) -> float:
+        """The time of the last keyframe of all tracks."""
+        return self.__timeline.duration()
+
+    def add(
+        self, target: Any, attr: str | None, *keyframes: Keyframe, space: ColorSpace = ColorSpace.kSRGB
+    ) -> Timeline:
+        """Adds a track that animates ``target.attr``.
+
+        The type of the track is that of the current value of the attribute if it is a :class:`skia.Point`,
+        :class:`skia.Color4f`, :class:`skia.Matrix` or :class:`skia.Path`, else it is guessed from the first keyframe.
+        A :class:`skia.Matrix` attribute, like :attr:`Entity.mat`, is updated in place.
+
+        :param target: The object whose attribute is animated, or if *attr* is ``None``, a function that is called with
+            the value of the track, like :meth:`Style.set_fill_color`.
+        :param attr: The name of the attribute.
+        :param keyframes: Tuples of (time, value) or (time, value, easing). The easing is used for the segment from the
+            previous keyframe, and must be a native :class:`skia.Easing`, like the functions in
+            :mod:`animator.anim.easing`. The default is linear. Colors can be anything accepted by :func:`color`.
+        :param space: The color space colors are interpolated in.
+        :return: The timeline itself.
+        """
+        if not keyframes:
+            raise ValueError('At least one keyframe is needed.')
+        current = getattr(target, attr, None) if attr is not None else None
+        if not isinstance(current, (skia.Path, skia.Matrix, skia.Color4f, skia.Point)):
+            current = keyframes[0][1]
+        track_type = _track_type(current)
+        track = self.__timeline.addTrack(track_type, space)
+        for time, value, *easing in keyframes:
+            if track_type == _TrackType.kColor and not isinstance(value, skia.Color4f):
+                value = color(value)
+            self.__timeline.addKeyframe(track, time, value, easing[0] if easing else None)
+        self.__targets.append((target, attr))
+        return self
+
+    def apply(self, t: float) -> None:
+        """Evaluates all tracks at time *t* and writes the values to their properties.
+
+        :param t: The time in seconds.
+        """
+        for (target, attr), value in zip(self.__targets, self.__timeline.evaluate(t)):
+            if value is None:
+                continue
+            if attr is None:
+                target(value)
+            elif isinstance(value, skia.Matrix):
+                getattr(target, attr).set9(value.get9())
+            else:
+                setattr(target, attr, value)
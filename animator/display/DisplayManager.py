@@ -8,11 +8,17 @@ from time import time
 from typing import TYPE_CHECKING, Any, Type
 
 if TYPE_CHECKING:
+    import numpy as np
+
     from animator.scene import Scene
 
 
 class DisplayManager(AbstractContextManager):
-    """Base class for display managers. A display manager manages the display of a scene."""
+    """Base class for display managers. A display manager manages the display of a scene.
+
+    :ivar frame: The frame that is displayed by :meth:`show_frame`. This is :attr:`Scene.frame` by default, but can be
+        set to another array of the same shape and format, like a buffer rendered on another thread.
+    """
 
     display_method: str | None = None
 
@@ -23,6 +29,7 @@ class DisplayManager(AbstractContextManager):
         :param delay: The delay between frames. If ``None``, the delay will be calculated from the scene's fps.
         """
         self.scene: Scene = scene
+        self.frame: np.ndarray = scene.frame
         self.width: int = scene.frame.shape[1]
         self.height: int = scene.frame.shape[0]
         self.delay: float = delay or 1 / scene.fps
@@ -41,7 +48,7 @@ class DisplayManager(AbstractContextManager):
 
     @abstractmethod
     def show_frame(self) -> bool:
-        """Displays the current frame and returns ``True``. If the window was closed, returns ``False``."""
+        """Displays :attr:`frame` and returns ``True``. If the window was closed, returns ``False``."""
         pass
 
     def close(self) -> None:
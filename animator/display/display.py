@@ -4,12 +4,15 @@ manager will be automatically selected."""
 from __future__ import annotations
 
 import time
-from typing import Any
+from typing import TYPE_CHECKING, Any
 
 from animator import skia
 from animator.display.DisplayManager import DisplayManager
 from animator.util.env import inside_notebook
 
+if TYPE_CHECKING:
+    import numpy as np
+
 # in browser
 if inside_notebook():
     from base64 import b64encode
@@ -23,7 +26,6 @@ if inside_notebook():
 class DM_html(DisplayManager):
     def __init__(self, *args: Any, **kwargs: Any) -> None:
         super().__init__(*args, **kwargs)
-        self.img: skia.Image = skia.Image.fromarray(self.scene.frame, copy=False)
         self.prefix = (
             '<div style="display:flex;justify-content:center;align-items:center">'
             f'<img style="max-width:100%;max-height:100%"id="{self.winname}"src="data:image/png;base64,'
@@ -32,7 +34,8 @@ class DM_html(DisplayManager):
         self.show_frame()
 
     def frame_b64(self) -> str:
-        return b64encode(self.img.encodeToData().bytes()).decode('utf-8')
+        img = skia.Image.fromarray(self.frame, self.scene.color_type, copy=False)
+        return b64encode(img.encodeToData().bytes()).decode('utf-8')
 
     def show_frame(self) -> bool:
         display(HTML(self.prefix + self.frame_b64() + self.suffix))
@@ -99,12 +102,18 @@ class DM_qt(DisplayManager):
         super().__init__(*args, **kwargs)
         self.app = QtWidgets.QApplication([])
         self.window = DM_qt.Window(self)
+        # Format_ARGB32 is stored as BGRA on little-endian machines
+        self.image_format = (
+            QtGui.QImage.Format_ARGB32
+            if self.scene.color_type == skia.ColorType.kBGRA_8888_ColorType
+            else QtGui.QImage.Format_RGBA8888
+        )
 
     def show_frame(self) -> bool:
         if self.running:
             self.window.pixmap.setPixmap(
                 QtGui.QPixmap(
-                    QtGui.QImage(self.scene.frame.data, self.width, self.height, QtGui.QImage.Format_RGBA8888)
+                    QtGui.QImage(self.frame.data, self.width, self.height, self.image_format)
                 )
             )
             time.sleep(self.waittime())
@@ -189,6 +198,7 @@ class DM_tk(DisplayManager):
     def __init__(self, *args: Any, **kwargs: Any) -> None:
         super().__init__(*args, **kwargs)
         self.frame_prefix = f'P6 {self.width} {self.height} 255 '.encode('utf-8')
+        self.bgra: bool = self.scene.color_type == skia.ColorType.kBGRA_8888_ColorType
         self.root = tk.Tk()
         self.root.title(self.winname)
         self.root.geometry(f'{self.width}x{self.height}')
@@ -210,7 +220,8 @@ class DM_tk(DisplayManager):
 
     def show_frame(self) -> bool:
         if self.running:
-            self.image.put(self.frame_prefix + self.scene.frame[:, :, :3].tobytes())
+            rgb = self.frame[:, :, 2::-1] if self.bgra else self.frame[:, :, :3]
+            self.image.put(self.frame_prefix + rgb.tobytes())
             self.root.update_idletasks()
             self.root.update()
         return self.running
@@ -228,7 +239,11 @@ class DM_tkf(DM_tk, DisplayManager):
         self.interp = ctypes.cast(self.image.tk.interpaddr(), Tcl_Interp_p)
         self.handle = Tk_FindPhoto(self.interp, self.image.name.encode('utf-8'))
         self.block = Tk_PhotoImageBlock(
-            width=self.width, height=self.height, pitch=self.width * 4, pixelSize=4, offset=(0, 1, 2, 3)
+            width=self.width,
+            height=self.height,
+            pitch=self.width * 4,
+            pixelSize=4,
+            offset=(2, 1, 0, 3) if self.bgra else (0, 1, 2, 3),
         )
 
     def show_frame(self) -> bool:
@@ -236,7 +251,7 @@ class DM_tkf(DM_tk, DisplayManager):
             Tk_PhotoPutBlock(
                 self.interp, self.handle, ctypes.byref(_clear_block), 0, 0, self.width, self.height, 0
             )  # fastest way to clear the image
-            self.block.pixelPtr = self.scene.frame.ctypes.data_as(c_uchar_p)
+            self.block.pixelPtr = self.frame.ctypes.data_as(c_uchar_p)
             Tk_PhotoPutBlock(self.interp, self.handle, ctypes.byref(self.block), 0, 0, self.width, self.height, 0)
             self.root.update_idletasks()
             self.root.update()
@@ -259,7 +274,10 @@ except ImportError:
 class DM_cv2(DisplayManager):
     def show_frame(self) -> bool:
         if self.running:
-            cv2.imshow(self.winname, cv2.cvtColor(self.scene.frame, cv2.COLOR_RGBA2BGR))
+            if self.scene.color_type == skia.ColorType.kBGRA_8888_ColorType:
+                cv2.imshow(self.winname, self.frame)  # OpenCV uses BGR(A), so no conversion is needed
+            else:
+                cv2.imshow(self.winname, cv2.cvtColor(self.frame, cv2.COLOR_RGBA2BGR))
             if (
                 cv2.waitKey(int(self.waittime() * 1000)) & 0xFF == 27
                 or cv2.getWindowProperty(self.winname, cv2.WND_PROP_AUTOSIZE) < 0
@@ -290,6 +308,7 @@ except ImportError:
 class DM_plt(DisplayManager):
     def __init__(self, *args: Any, **kwargs: Any) -> None:
         super().__init__(*args, **kwargs)
+        self.bgra: bool = self.scene.color_type == skia.ColorType.kBGRA_8888_ColorType
         self._default_toolbar = matplotlib.rcParams['toolbar']
         matplotlib.rcParams['toolbar'] = 'None'
         dpi = matplotlib.rcParams['figure.dpi']
@@ -308,19 +327,23 @@ class DM_plt(DisplayManager):
             window.setFixedSize(window.size())
         elif backend.startswith('tk'):
             self.fig.canvas.manager.window.resizable(False, False)
-        self.img = plt.imshow(self.scene.frame, interpolation='nearest')
+        self.img = plt.imshow(self.rgba_frame(), interpolation='nearest')
         plt.axis('off')
         plt.ion()
         plt.show()
 
     def show_frame(self) -> bool:
         if plt.fignum_exists(self.fig.number):
-            self.img.set_data(self.scene.frame)
+            self.img.set_data(self.rgba_frame())
             self.fig.canvas.draw_idle()
             self.fig.canvas.start_event_loop(self.waittime())
             return True
         return False
 
+    def rgba_frame(self) -> np.ndarray:
+        """The frame in RGBA order, which is what matplotlib expects."""
+        return self.frame[..., [2, 1, 0, 3]] if self.bgra else self.frame
+
     def close(self) -> None:
         plt.close(self.fig.number)
         matplotlib.rcParams['toolbar'] = self._default_toolbar
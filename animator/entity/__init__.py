@@ -5,6 +5,8 @@ from animator.entity.image import Image as Image
 from animator.entity.image import PaintFill as PaintFill
 from animator.entity.image import Snapshot as Snapshot
 from animator.entity.misc import BackDrop as BackDrop
+from animator.entity.misc import Mesh as Mesh
+from animator.entity.misc import ParticleSystem as ParticleSystem
 from animator.entity.misc import Patch as Patch
 from animator.entity.misc import Vertices as Vertices
 from animator.entity.path import Circle as Circle
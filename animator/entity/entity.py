@@ -17,6 +17,11 @@ if TYPE_CHECKING:
 
     ET = TypeVar('ET', bound='Entity')
 
+_CACHE_BOUNDS = skia.Rect.MakeLTRB(-1e9, -1e9, 1e9, 1e9)  # the cached content is not culled by the recorder
+_MAX_LAYER_PIXELS = 1 << 24  # larger layers are replayed as pictures instead of being rasterized
+_LAYER_SAMPLING = skia.SamplingOptions(skia.FilterMode.kLinear)
+_IDENTITY = skia.Matrix()  # used to copy matrices in place with setConcat()
+
 
 class Entity:
     """The base entity class.
@@ -24,16 +29,38 @@ class Entity:
     :ivar pos: The position of the entity. This is the origin of the entity.
     :ivar transformation: Convenience object for applying transformations to the entity.
     :ivar offset: The extra offset to draw the entity at after applying the entity's transformation.
-    :ivar z_index: The z-index of the entity. Entities with a higher z-index are drawn on top of entities with a lower
-        z-index.
     :ivar visible: Whether the entity is drawn. This does not affect the entity's children.
     :ivar style: The :class:`Style` of the entity.
     :ivar children: The children of this entity.
     :ivar _is_dirty: Entities may cache some values for performance. This flag is set to ``True`` when the entity needs
         to recalculate its cached values. Subclasses may implement methods to automatically detect when this flag needs
         to be set.
+    :ivar _revision: Incremented every time :attr:`_is_dirty` is set to ``True``. Unlike :attr:`_is_dirty`, this is
+        never reset, so it can be used to detect changes by more than one cache.
+    :cvar cache_content: Whether the drawing commands of :meth:`on_draw` are recorded into a :class:`skia.Picture` and
+        replayed while the entity does not change. Only enable this if :meth:`_cache_key` covers everything that
+        :meth:`on_draw` depends on. Can be overridden per instance.
+    :ivar cache_hits: The number of times the cached content was replayed.
+    :ivar cache_misses: The number of times the content was recorded again.
+    :cvar complete_cache_key: Whether :meth:`_cache_key` changes every time the output of :meth:`on_draw` changes.
+        Caches that are kept across frames (see :attr:`Group.cache_as_bitmap` and :attr:`Scene.incremental`) treat an
+        entity without a complete key as changed in every frame. Can be enabled per instance for an entity whose content
+        is only changed through methods that call :meth:`_mark_dirty`.
+    :cvar cullable: Whether the entity is skipped while drawing when its bounds (see :meth:`_draw_bounds`) are outside
+        of the clip of the canvas. Disable this for entities that draw outside of :meth:`get_bounds`.
+
+    The world matrix (see :attr:`total_transformation`) and the world bounds of each entity are cached. The cache
+    stores a copy of *pos* and *mat*, the parent and the version of the parent's world matrix it was computed from, so
+    only the subtree below an entity whose *pos*, *mat*, *offset* or parent changed computes them again. While a
+    :class:`Scene` draws a frame, each entity checks its cache at most once, after its parent, so the check is O(1) per
+    entity instead of walking up the parent chain. Call :meth:`_invalidate_world` after changing *pos* or *mat* while
+    drawing.
     """
 
+    cache_content: bool = False
+    complete_cache_key: bool = False
+    cullable: bool = True
+
     def __init__(self, pos: PointLike | None = None, **kwargs: Any) -> None:
         """
         :param pos: The position of the entity.
@@ -45,7 +72,8 @@ class Entity:
         self.__mat: skia.Matrix = skia.Matrix()
         self.transformation = Transformation(self.__mat)
         self.offset: skia.Point = skia.Point(0, 0)
-        self.z_index: int = 0
+        self._entity_lists: dict[int, EntityList] = {}  # the lists containing this entity, by id
+        self.__z_index: int = 0
         self.visible: bool = True
         self.style: Style = Style()
 
@@ -55,7 +83,52 @@ class Entity:
         self.children: EntityList = EntityList()
         self.__parent: Entity | None = None
         self._scene: Scene = None  # type: ignore lateinit
-        self._is_dirty: bool = True
+        self._revision: int = 0
+        self._is_dirty = True
+
+        self.cache_hits: int = 0
+        self.cache_misses: int = 0
+        self.__cache: skia.Picture | None = None
+        self.__cache_key: tuple | None = None
+
+        self.__world: skia.Matrix = skia.Matrix()
+        self.__world_version: int = 0
+        self.__local_version: int = 0
+        self.__world_pos: skia.Point = skia.Point(0, 0)
+        self.__world_mat: skia.Matrix = skia.Matrix()
+        self.__world_parent: Entity | None = None
+        self.__world_parent_version: int = -2  # never matches, so the first call computes the matrix
+        self.__world_epoch: int = 0  # the draw pass of the scene in which the cache was last checked
+        self.__world_bounds: skia.Rect = skia.Rect.MakeEmpty()
+        self.__world_bounds_key: tuple | None = None
+        self.__draw_bounds: skia.Rect | None = None
+        self.__draw_bounds_key: tuple | None = None
+        self.__draw_bounds_paint: skia.Paint | None = None
+
+    @property
+    def _is_dirty(self) -> bool:
+        return self.__is_dirty
+
+    @_is_dirty.setter
+    def _is_dirty(self, value: bool) -> None:
+        self.__is_dirty = value
+        if value:
+            self._revision += 1
+
+    @property
+    def z_index(self) -> int:
+        """
+        The z-index of the entity. Entities with a higher z-index are drawn on top of entities with a lower z-index.
+        Changing it marks the lists containing this entity as unsorted.
+        """
+        return self.__z_index
+
+    @z_index.setter
+    def z_index(self, value: int) -> None:
+        if value != self.__z_index:
+            self.__z_index = value
+            for entity_list in self._entity_lists.values():
+                entity_list._invalidate()
 
     @property
     def mat(self) -> skia.Matrix:
@@ -81,20 +154,87 @@ class Entity:
         for child in self.children:
             child.set_visibility(visible)
 
+    def _world_matrix(self) -> skia.Matrix:
+        """
+        The cached total transformation of this entity. It is computed again only if *pos*, *mat*, the parent or the
+        parent's world matrix changed since the last call, in which case :attr:`_world_version` is incremented. The
+        returned matrix must not be modified. While the scene is drawing (see :attr:`Scene._world_epoch`), the cache is
+        only checked the first time in each frame.
+        """
+        epoch = 0 if self._scene is None else self._scene._world_epoch
+        if epoch and epoch == self.__world_epoch:
+            return self.__world
+        parent = self.__parent
+        parent_version = -1 if parent is None else parent.__validate_world()
+        if (
+            parent_version != self.__world_parent_version
+            or parent is not self.__world_parent
+            or self.pos != self.__world_pos
+            or self.__mat != self.__world_mat
+        ):
+            if self.pos != self.__world_pos or self.__mat != self.__world_mat:
+                self.__local_version += 1
+            self.__world.setTranslate(self.pos.fX, self.pos.fY).preConcat(self.__mat)
+            if parent is not None:
+                self.__world.postConcat(parent.__world)
+            self.__world_pos.set(self.pos.fX, self.pos.fY)
+            self.__world_mat.setConcat(self.__mat, _IDENTITY)
+            self.__world_parent = parent
+            self.__world_parent_version = parent_version
+            self.__world_version += 1
+        self.__world_epoch = epoch
+        return self.__world
+
+    def _invalidate_world(self) -> None:
+        """
+        Makes this entity and its descendants check their cached world matrix again during the current draw pass. Call
+        this after changing *pos* or *mat* while the scene is drawing.
+        """
+        self.__world_epoch = 0
+        for child in self.children:
+            child._invalidate_world()
+
+    def __validate_world(self) -> int:
+        self._world_matrix()
+        return self.__world_version
+
+    @property
+    def _world_version(self) -> int:
+        """Incremented every time the world matrix of this entity changes."""
+        return self.__validate_world()
+
+    @property
+    def _local_version(self) -> int:
+        """Incremented every time *pos* or *mat* of this entity changes, but not when only its parent moves."""
+        self.__validate_world()
+        return self.__local_version
+
     @property
     def total_transformation(self) -> skia.Matrix:
-        """The total transformation of this entity, including its parent's transformation."""
-        if self.__parent is None:
-            return skia.Matrix.Translate(self.pos).preConcat(self.__mat)
-        else:
-            return self.__parent.total_transformation.preTranslate(*self.pos).preConcat(self.__mat)
+        """The total transformation of this entity, including its parent's transformation. This is a copy of the cached
+        world matrix, so it can be modified."""
+        return skia.Matrix.Concat(self._world_matrix(), _IDENTITY)
 
     @property
     def absolute_position(self) -> skia.Point:
         """The absolute position of this entity in the scene, after applying its parent's transformation."""
         if self.__parent is None:
             return skia.Point(*self.pos)
-        return self.__parent.total_transformation.mapXY(*self.pos)
+        return self.__parent._world_matrix().mapXY(*self.pos)
+
+    @property
+    def world_bounds(self) -> skia.Rect:
+        """
+        The bounds of this entity in the scene, after applying its total transformation. This is cached until the
+        world matrix, the *offset* or :attr:`_revision` changes; call :meth:`_mark_dirty` if :meth:`get_bounds`
+        changed in some other way. The returned rect must not be modified.
+        """
+        world = self._world_matrix()
+        key = (self.__world_version, self._revision, self.offset.fX, self.offset.fY)
+        if key != self.__world_bounds_key:
+            self.__world_bounds = world.mapRect(self.get_bounds())
+            self.__world_bounds_key = key
+        return self.__world_bounds
 
     def add(self, *children: Entity) -> None:
         """Add one or more children to this entity."""
@@ -296,25 +436,180 @@ class Entity:
         if self.style.paint_style == Style.PaintStyle.FILL_THEN_STROKE:
             self.do_stroke(canvas)
 
+    def _cache_key(self) -> tuple:
+        """
+        The key of the cached content (see :attr:`cache_content`). The content is recorded again when the key changes.
+        Subclasses should extend the key with any other state that :meth:`on_draw` depends on.
+        """
+        return self._revision, self.style.revision, self.offset.fX, self.offset.fY
+
+    def _content_uses_matrix(self) -> bool:
+        """
+        Whether :meth:`on_draw` depends on the total matrix of the canvas. If ``True``, the cached content is recorded
+        in device space and recorded again whenever the matrix changes.
+        """
+        return False
+
+    def __draw_cached(self, canvas: skia.Canvas) -> None:
+        """Replay the cached content of the entity on the *canvas*, recording it first if it is stale."""
+        matrix = canvas.getTotalMatrix() if self._content_uses_matrix() else None
+        key = (self._cache_key(), matrix)
+        if self.__cache is None or key != self.__cache_key:
+            recorder = skia.PictureRecorder()
+            recording_canvas = recorder.beginRecording(_CACHE_BOUNDS)
+            if matrix is not None:
+                recording_canvas.setMatrix(matrix)
+            self.on_draw(recording_canvas)
+            self.__cache = recorder.finishRecordingAsPicture()
+            self.__cache_key = key
+            self.cache_misses += 1
+        else:
+            self.cache_hits += 1
+        if matrix is not None:
+            canvas.resetMatrix()
+        canvas.drawPicture(self.__cache)
+
     def _transform_and_draw(self, canvas: skia.Canvas) -> None:
         """Draw the entity on the given *canvas*."""
         if self.style.nothing_to_draw():
             return
         save_count = canvas.save()
-        canvas.concat(self.total_transformation)
+        canvas.concat(self._world_matrix())
         self.style.apply_clip(canvas)
         self.style.apply_final_paint(canvas)
 
-        self.on_draw(canvas)
+        if self.cache_content:
+            self.__draw_cached(canvas)
+        else:
+            self.on_draw(canvas)
 
         canvas.restoreToCount(save_count)
 
+    def _draw_state(self) -> tuple | None:
+        """
+        A snapshot of the state that affects how this entity and its children are drawn relative to its parent. This
+        is used by :attr:`Group.cache_as_bitmap` and :attr:`Scene.incremental` to detect changes in a subtree. It only
+        holds the version stamps of each entity (:meth:`_cache_key`, :attr:`_local_version` and
+        :attr:`Style.final_revision`), so comparing it does not copy any paint or matrix. Returns ``None`` if a visible
+        entity in the subtree does not have a :attr:`complete_cache_key`, in which case the subtree must be treated as
+        changed.
+        """
+        if self.visible and not self.complete_cache_key:
+            return None
+        children = []
+        for child in self.children:
+            state = child._draw_state()
+            if state is None:
+                return None
+            children.append(state)
+        return (
+            self.visible,
+            self._cache_key(),
+            self._local_version,
+            self.style.final_revision,
+            tuple(children),
+        )
+
+    def __compute_draw_bounds(self) -> skia.Rect | None:
+        try:
+            bounds = self.get_bounds()
+        except NotImplementedError:
+            return None
+        style = self.style
+        paints = []
+        if style.paint_style != Style.PaintStyle.STROKE_ONLY:
+            paints.append(style.fill_paint)
+        if style.paint_style != Style.PaintStyle.FILL_ONLY:
+            paints.append(style.stroke_paint)
+        drawn = skia.Rect.MakeEmpty()
+        for paint in paints:
+            if not paint.canComputeFastBounds():
+                return None
+            drawn.join(paint.computeFastBounds(bounds))
+        if not style.final_paint.canComputeFastBounds():
+            return None
+        return self._world_matrix().mapRect(style.final_paint.computeFastBounds(drawn))
+
+    def _draw_bounds(self) -> skia.Rect | None:
+        """
+        The bounds of everything this entity draws, without its children, in the coordinates of the canvas it is drawn
+        on. This includes the stroke, mask filters, and the image filter (like a shadow) of ``final_paint``. It is
+        cached until the world matrix, :meth:`_cache_key` or ``final_paint`` changes. Returns ``None`` if the bounds
+        are unknown, in which case the entity is never culled. Entities with empty bounds are never culled either, so
+        that stale bounds of an entity that did not invalidate its cache cannot hide it.
+        """
+        if not self.cullable or self._content_uses_matrix():
+            return None
+        key = (self._world_version, self._cache_key())
+        final_paint = self.style.final_paint
+        if key != self.__draw_bounds_key or final_paint != self.__draw_bounds_paint:
+            self.__draw_bounds = self.__compute_draw_bounds()
+            self.__draw_bounds_key = key
+            self.__draw_bounds_paint = skia.Paint(final_paint)
+        return self.__draw_bounds
+
+    def _tree_bounds(self) -> skia.Rect | None:
+        """
+        The union of the :meth:`_draw_bounds` of this entity and all its descendants, or ``None`` if any is unknown.
+        """
+        bounds = skia.Rect.MakeEmpty()
+        if self.visible:
+            own = self._draw_bounds()
+            if own is None:
+                return None
+            bounds.join(own)
+        for child in self.children:
+            child_bounds = child._tree_bounds()
+            if child_bounds is None:
+                return None
+            bounds.join(child_bounds)
+        return bounds
+
+    def _opaque_rect(self) -> skia.Rect | None:
+        """
+        A rectangle, in the coordinates of this entity, which is completely covered by opaque pixels when the entity is
+        drawn, or ``None``. Subclasses that draw opaque rectangles should override this and check
+        :meth:`Style.is_fill_opaque`.
+        """
+        return None
+
+    def _opaque_rects(self, matrix: skia.Matrix) -> list[skia.Rect]:
+        """
+        The device space rectangles covered by opaque pixels of this entity and its descendants, when drawn on a canvas
+        with the total matrix *matrix*. Only rectangles that stay rectangles on the device are used, and they are
+        shrunk to whole pixels, since anti-aliased edges are not opaque.
+        """
+        rects = []
+        rect = self._opaque_rect() if self.visible and not self.style.nothing_to_draw() else None
+        if rect is not None:
+            world = skia.Matrix.Concat(matrix, self._world_matrix())
+            if world.rectStaysRect():
+                device = world.mapRect(rect).roundIn()
+                if not device.isEmpty():
+                    rects.append(skia.Rect(device))
+        for child in self.children:
+            rects.extend(child._opaque_rects(matrix))
+        return rects
+
+    def _count_draw(self, culled: bool) -> None:
+        """Adds to the counters of the scene for the current frame."""
+        if self._scene is not None:
+            if culled:
+                self._scene.culled_count += 1
+            else:
+                self._scene.drawn_count += 1
+
     def draw(self, canvas: skia.Canvas | None = None) -> None:
-        """Draw the entity and its children."""
+        """Draw the entity and its children. The entity is skipped if its bounds are outside of the clip."""
         if self.visible:
-            self._transform_and_draw(self._scene.canvas if canvas is None else canvas)
+            target = self._scene.canvas if canvas is None else canvas
+            bounds = self._draw_bounds()
+            culled = bounds is not None and not bounds.isEmpty() and target.quickReject(bounds)
+            if not culled:
+                self._transform_and_draw(target)
+            self._count_draw(culled)
         for child in self.children:
-            child.draw()
+            child.draw(canvas)
 
 
 class Group(Entity):
@@ -326,37 +621,154 @@ class Group(Entity):
     Normally, an entity's ``clip`` and ``final_paint`` only apply to itself. However, a group will apply its ``clip``
     and ``final_paint`` to all of its children. The bounds of a group is the union of all of its children's bounds. The
     group can also be used to blend its children.
+
+    :ivar cache_as_bitmap: Whether the children are rasterized once into an image at device resolution, which is then
+        composited every frame. The image is rasterized again when any descendant changes (see
+        :meth:`Entity._draw_state`), or when the scale, rotation or skew of the group on the canvas changes by more than
+        *cache_tolerance*. Translating the group reuses the image. The image is only reused while every visible
+        descendant has a :attr:`Entity.complete_cache_key`, like paths and text; otherwise it is rasterized in every
+        frame. Call :meth:`invalidate_cache` after changing a descendant in a way its key does not detect. The children
+        are blended with each other in isolation, so *child_blender* does not blend them with the content behind the
+        group.
+    :ivar cache_tolerance: The largest change of the scale and skew factors of the total matrix for which the cached
+        image is reused.
     """
 
-    def __init__(self, child_blender: _BlenderLike | None = None, **kwargs):
+    complete_cache_key = True  # a group draws nothing itself
+
+    def __init__(self, child_blender: _BlenderLike | None = None, cache_as_bitmap: bool = False, **kwargs):
         """
         :param child_blender: If not ``None``, the blender is used for all children on top of their own blend mode.
+        :param cache_as_bitmap: Whether to cache the rasterized children. See :attr:`cache_as_bitmap`.
         """
         super().__init__(**kwargs)
         self.child_blender = child_blender if child_blender is None else _to_blender(child_blender)
+        self.cache_as_bitmap: bool = cache_as_bitmap
+        self.cache_tolerance: float = 1e-3
+
+        self.__layer_picture: skia.Picture | None = None
+        self.__layer_image: skia.Image | None = None
+        self.__layer_origin: skia.Point = skia.Point(0, 0)
+        self.__layer_translate: skia.Point = skia.Point(0, 0)
+        self.__layer_linear: tuple[float, float, float, float] = (0, 0, 0, 0)
+        self.__layer_state: tuple | None = None
+
+    def invalidate_cache(self) -> None:
+        """Rasterizes the children again the next time the group is drawn with :attr:`cache_as_bitmap`."""
+        self.__layer_state = None
+
+    def __draw_children(self, canvas: skia.Canvas) -> None:
+        for child in self.children:
+            if self.child_blender is not None:
+                canvas.saveLayer(None, skia.Paint(blender=self.child_blender))
+            child.draw(canvas)
+            if self.child_blender is not None:
+                canvas.restore()
+
+    def __rasterize_layer(self, canvas_matrix: skia.Matrix, tx: float, ty: float) -> None:
+        """
+        Record the children with the translation of the group on the device snapped to whole pixels, and rasterize
+        them into an image covering the bounds of the recording.
+        """
+        ix, iy = math.floor(tx), math.floor(ty)
+        recorder = skia.PictureRecorder()
+        recording_canvas = recorder.beginRecording(_CACHE_BOUNDS, skia.RTreeFactory())
+        recording_canvas.setMatrix(skia.Matrix.Translate(-ix, -iy).preConcat(canvas_matrix))
+        self.__draw_children(recording_canvas)
+        self.__layer_picture = recorder.finishRecordingAsPicture()
+        self.__layer_image = None
+        self.__layer_origin.set(ix, iy)
+        self.__layer_translate.set(tx, ty)
+
+        bounds = self.__layer_picture.cullRect().roundOut()
+        if bounds.isEmpty() or bounds.width() * bounds.height() > _MAX_LAYER_PIXELS:
+            return
+        surface = skia.Surface(bounds.width(), bounds.height())
+        surface_canvas = surface.getCanvas()
+        surface_canvas.translate(-bounds.left(), -bounds.top())
+        surface_canvas.drawPicture(self.__layer_picture)
+        self.__layer_image = surface.makeImageSnapshot()
+        self.__layer_origin.offset(bounds.left(), bounds.top())
+
+    def __draw_layer(self, canvas: skia.Canvas) -> None:
+        """Composite the cached image of the children, rasterizing it first if it is stale."""
+        canvas_matrix = canvas.getTotalMatrix()
+        matrix = skia.Matrix.Concat(canvas_matrix, self._world_matrix())
+        if matrix.hasPerspective():
+            self.__draw_children(canvas)
+            return
+        linear = (matrix.getScaleX(), matrix.getSkewX(), matrix.getSkewY(), matrix.getScaleY())
+        tx, ty = matrix.getTranslateX(), matrix.getTranslateY()
+        states = [child._draw_state() for child in self.children]
+        state = None if None in states else tuple(states)
+        if (
+            state is None
+            or state != self.__layer_state
+            or any(abs(a - b) > self.cache_tolerance for a, b in zip(linear, self.__layer_linear))
+        ):
+            self.__rasterize_layer(canvas_matrix, tx, ty)
+            self.__layer_state = state
+            self.__layer_linear = linear
+            self.cache_misses += 1
+        else:
+            self.cache_hits += 1
+
+        canvas.resetMatrix()
+        dx, dy = tx - self.__layer_translate.fX, ty - self.__layer_translate.fY
+        if self.__layer_image is not None:
+            canvas.drawImage(
+                self.__layer_image, self.__layer_origin.fX + dx, self.__layer_origin.fY + dy, _LAYER_SAMPLING
+            )
+        else:
+            canvas.translate(self.__layer_origin.fX + dx, self.__layer_origin.fY + dy)
+            canvas.drawPicture(self.__layer_picture)
+
+    def _draw_bounds(self) -> skia.Rect | None:
+        return skia.Rect.MakeEmpty()  # a group draws nothing itself
+
+    def _tree_bounds(self) -> skia.Rect | None:
+        if not self.cullable:
+            return None
+        bounds = super()._tree_bounds()
+        if bounds is None or not self.style.final_paint.canComputeFastBounds():
+            return None
+        bounds.offset(self.offset)
+        return self.style.final_paint.computeFastBounds(bounds)
+
+    def _opaque_rects(self, matrix: skia.Matrix) -> list[skia.Rect]:
+        if self.child_blender is not None or self.style.nothing_to_draw() or not self.style.is_layer_opaque():
+            return []
+        matrix = skia.Matrix.Concat(matrix, skia.Matrix.Translate(self.offset.fX, self.offset.fY))
+        return [rect for child in self.children for rect in child._opaque_rects(matrix)]
 
     def draw(self, canvas: skia.Canvas | None = None) -> None:
         if self.style.nothing_to_draw():
             return
         canvas = self._scene.canvas if canvas is None else canvas
+        bounds = self._tree_bounds()
+        if bounds is not None and not bounds.isEmpty() and canvas.quickReject(bounds):
+            self._count_draw(True)  # the whole subtree is skipped
+            return
         save_count = canvas.save()
         if self.style.clip is not None:
             total_matrix = canvas.getTotalMatrix()  # local stack for matrix
-            canvas.concat(self.total_transformation)
+            canvas.concat(self._world_matrix())
             self.style.apply_clip(canvas)
             canvas.setMatrix(total_matrix)
         self.style.apply_final_paint(canvas)
 
         canvas.translate(self.offset.fX, self.offset.fY)
-        for child in self.children:
-            if self.child_blender is not None:
-                canvas.saveLayer(None, skia.Paint(blender=self.child_blender))
-            child.draw()
-            if self.child_blender is not None:
-                canvas.restore()
+        if self.cache_as_bitmap:
+            self.__draw_layer(canvas)
+        else:
+            self.__draw_children(canvas)
 
         canvas.restoreToCount(save_count)
 
+    def _draw_state(self) -> tuple | None:
+        state = super()._draw_state()
+        return None if state is None else state + (self.child_blender,)
+
     def get_bounds(self, transformed: bool = False) -> skia.Rect:
         bounds = skia.Rect.MakeEmpty()
         for child in self.children:
@@ -364,3 +776,12 @@ class Group(Entity):
             bound.offset(child.pos)
             bounds.join(self.mat.mapRect(bound, skia.ApplyPerspectiveClip.kNo) if transformed else bound)
         return bounds
+
+    @property
+    def world_bounds(self) -> skia.Rect:
+        """The union of the world bounds of the children, which are cached individually."""
+        bounds = skia.Rect.MakeEmpty()
+        for child in self.children:
+            bounds.join(child.world_bounds)
+        bounds.offset(self.offset)
+        return bounds
@@ -1,21 +1,136 @@
 from __future__ import annotations
 
-from typing import TYPE_CHECKING, Iterable, SupportsIndex
+from bisect import bisect_left, bisect_right
+from typing import TYPE_CHECKING, Iterable, Iterator, SupportsIndex
 
 if TYPE_CHECKING:
     from animator.entity.entity import Entity
 
 
 class EntityList(list['Entity']):
-    """A list of entities, sorted by their z-index."""
+    """A list of entities, sorted by their z-index. Entities with the same z-index are kept in the order they were added.
+
+    Entities are inserted and removed with a binary search instead of sorting the whole list. Finding the position is
+    O(log N), but the insertion or deletion itself still shifts the entities after it, which is O(N). That shift is a
+    single memmove of pointers, far cheaper than sorting, and keeping a plain list means the list itself is the draw
+    order and can be passed to code that iterates over a list directly. When the z-index of an entity in the list
+    changes, the list is only marked as unsorted, and is sorted again the next time it is accessed.
+    """
+
+    def __init__(self) -> None:
+        super().__init__()
+        self.__order: dict[Entity, int] = {}  # the insertion order of each entity, to break ties
+        self.__count: dict[Entity, int] = {}  # the number of occurrences of each entity
+        self.__next_order: int = 0
+        self.__sorted: bool = True
+
+    def __key(self, entity: Entity) -> tuple[int, int]:
+        return entity.z_index, self.__order[entity]
+
+    def __add_entity(self, entity: Entity) -> None:
+        if entity in self.__order:  # a duplicate shares the order of the first one, so that its key doesn't change
+            self.__count[entity] += 1
+        else:
+            self.__order[entity] = self.__next_order
+            self.__count[entity] = 1
+            self.__next_order += 1
+            entity._entity_lists[id(self)] = self
+        super().insert(bisect_right(self, self.__key(entity), key=self.__key), entity)
+
+    def __remove_entity(self, entity: Entity) -> None:
+        """Forgets *entity* after one occurrence was removed, unless it is still in the list as a duplicate."""
+        count = self.__count[entity] - 1
+        if count:
+            self.__count[entity] = count
+        else:
+            del self.__order[entity]
+            del self.__count[entity]
+            entity._entity_lists.pop(id(self), None)
+
+    def _invalidate(self) -> None:
+        """Called when the z-index of an entity in this list changes."""
+        self.__sorted = False
+
+    def _ensure_sorted(self) -> None:
+        """Sorts the list if the z-index of any of its entities changed. This is mostly in order already."""
+        if not self.__sorted:
+            super().sort(key=self.__key)
+            self.__sorted = True
 
     def append(self, entity: Entity) -> None:
-        super().append(entity)
-        self.sort(key=lambda e: e.z_index)
+        self._ensure_sorted()
+        self.__add_entity(entity)
 
     def extend(self, entities: Iterable[Entity]) -> None:
-        super().extend(entities)
-        self.sort(key=lambda e: e.z_index)
+        self._ensure_sorted()
+        for entity in list(entities):  # copied, since *entities* may be this list
+            self.__add_entity(entity)
+
+    def __iadd__(self, entities: Iterable[Entity]) -> EntityList:  # type: ignore
+        self.extend(entities)
+        return self
+
+    def __imul__(self, n: SupportsIndex) -> EntityList:  # type: ignore
+        entities = list(self)
+        if n.__index__() <= 0:
+            self.clear()
+        for _ in range(n.__index__() - 1):
+            self.extend(entities)
+        return self
+
+    def remove(self, entity: Entity) -> None:
+        if entity not in self.__order:
+            raise ValueError('Entity is not in the list.')
+        self._ensure_sorted()
+        super().__delitem__(bisect_left(self, self.__key(entity), key=self.__key))
+        self.__remove_entity(entity)
+
+    def pop(self, index: SupportsIndex = -1) -> Entity:
+        self._ensure_sorted()
+        entity = super().pop(index)
+        self.__remove_entity(entity)
+        return entity
+
+    def clear(self) -> None:
+        for entity in self.__order:
+            entity._entity_lists.pop(id(self), None)
+        super().clear()
+        self.__order.clear()
+        self.__count.clear()
+
+    def __iter__(self) -> Iterator[Entity]:
+        self._ensure_sorted()
+        return super().__iter__()
+
+    def __reversed__(self) -> Iterator[Entity]:
+        self._ensure_sorted()
+        return super().__reversed__()
+
+    def __getitem__(self, index):  # type: ignore
+        self._ensure_sorted()
+        return super().__getitem__(index)
+
+    def __contains__(self, entity: object) -> bool:
+        return entity in self.__order
+
+    def __delitem__(self, index: SupportsIndex | slice) -> None:
+        self._ensure_sorted()
+        removed = super().__getitem__(index)
+        super().__delitem__(index)
+        for entity in removed if isinstance(index, slice) else (removed,):
+            self.__remove_entity(entity)
+
+    def __setitem__(self, index, value) -> None:  # type: ignore
+        """Replaces the entities at *index*. The new entities are still placed by their z-index, not at *index*."""
+        new = list(value) if isinstance(index, slice) else [value]
+        del self[index]
+        self.extend(new)
 
     def insert(self, _index: SupportsIndex, _object: Entity) -> None:
         raise NotImplementedError("Use EntityList.append instead")
+
+    def sort(self, *_args, **_kwargs) -> None:  # type: ignore
+        raise NotImplementedError("EntityList is always sorted by z-index")
+
+    def reverse(self) -> None:
+        raise NotImplementedError("EntityList is always sorted by z-index")
@@ -88,6 +88,7 @@ class Image(Entity):
         self.__image = self.__image.resize(self.width, self.height, self.sampling_options)
 
         self.__ndarray = None
+        self._mark_dirty()
         return self
 
     def resize(self: IT, width: int | None = None, height: int | None = None) -> IT:
@@ -101,6 +102,7 @@ class Image(Entity):
         self.height = self.__image.height() * width // self.__image.width() if height is None else height  # type: ignore width is not None
         self.__image = self.__image.resize(self.width, self.height, self.sampling_options)
         self.__ndarray = None
+        self._mark_dirty()
         return self
 
     def on_draw(self, canvas: skia.Canvas) -> None:
@@ -111,6 +113,11 @@ class Image(Entity):
             self.style.fill_paint,
         )
 
+    def _opaque_rect(self) -> skia.Rect | None:
+        if self.__image.isOpaque() and self.style.is_fill_opaque():
+            return self.get_bounds()
+        return None
+
     def get_bounds(self, transformed: bool = False) -> skia.Rect:
         bounds = skia.Rect.MakeXYWH(self.offset.fX, self.offset.fY, self.width, self.height)
         if transformed:
@@ -148,11 +155,16 @@ class Snapshot(Entity):
 class PaintFill(Entity):
     """Fills the whole scene with the ``fill_paint``."""
 
+    cullable = False
+
     def __init__(self, pos: PointLike = (0, 0), **kwargs: Any) -> None:
         super().__init__(pos=pos, **kwargs)
 
     def on_draw(self, canvas: skia.Canvas) -> None:
         canvas.drawPaint(self.style.fill_paint)
 
+    def _opaque_rect(self) -> skia.Rect | None:
+        return skia.Rect.MakeLTRB(-1e9, -1e9, 1e9, 1e9) if self.style.is_fill_opaque() else None
+
     def get_bounds(self, transformed: bool = False) -> skia.Rect:
         return skia.Rect.MakeEmpty()
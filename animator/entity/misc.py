@@ -1,6 +1,9 @@
 """Misceleaneous entities."""
 from typing import Any
 
+import numpy as np
+import numpy.typing as npt
+
 from animator import skia
 from animator._common_types import ClipLike, ColorLike, PointLike
 from animator.entity.entity import Entity
@@ -74,6 +77,192 @@ class Vertices(Entity):
         return bounds
 
 
+class Mesh(Entity):
+    """
+    A mesh of vertices stored in numpy arrays and drawn as triangles with the ``fill_paint``. Unlike :class:`Vertices`,
+    no Python object is created per vertex, so large meshes can be deformed every frame by writing into the arrays. The
+    :class:`skia.Vertices` are rebuilt only when :attr:`version`, the *mode* or the offset changes. Assigning any of the
+    arrays increments the version; call :meth:`changed` after modifying them in place.
+    """
+
+    def __init__(
+        self,
+        positions: npt.ArrayLike,
+        colors: npt.ArrayLike | None = None,
+        mode: skia.Vertices.VertexMode = skia.Vertices.VertexMode.kTriangles_VertexMode,
+        textures: npt.ArrayLike | None = None,
+        indices: npt.ArrayLike | None = None,
+        blend_mode: skia.BlendMode | None = None,
+        **kwargs: Any,
+    ):
+        """
+        :param positions: The positions of the vertices, as an array of shape=(N, 2). A float32 C-contiguous array is
+            used as is, without copying.
+        :param colors: The ARGB colors for each vertex, as an array of shape=(N,). If not provided, the fill paint's
+            color is used.
+        :param mode: The vertex mode. The default is ``kTriangles``.
+        :param textures: The texture coordinates in the fill paint's shader space for each vertex, as an array of
+            shape=(N, 2).
+        :param indices: The indices of the vertices to use to draw the triangles.
+        :param blend_mode: The blend mode to use to blend the *colors* (if provided) with the fill paint. If *colors* is
+            not provided, the default is ``kSrcOver``. Otherwise, the default is ``kDstOver``.
+        """
+        super().__init__(**kwargs)
+        self.positions = positions
+        self.colors = colors
+        self.textures = textures
+        self.indices = indices
+        self.mode: skia.Vertices.VertexMode = mode
+        self.blend_mode: skia.BlendMode = (
+            (skia.BlendMode.kSrcOver if colors is None else skia.BlendMode.kDstOver)
+            if blend_mode is None
+            else blend_mode
+        )
+
+        self.__vertices: skia.Vertices = None  # type: ignore lateinit
+        self.__vertices_key: tuple | None = None
+
+    @property
+    def positions(self) -> np.ndarray:
+        """The float32 array of shape=(N, 2) of the vertex positions."""
+        return self.__positions
+
+    @positions.setter
+    def positions(self, positions: npt.ArrayLike) -> None:
+        self.__positions = np.ascontiguousarray(positions, np.float32).reshape(-1, 2)
+        self.changed()
+
+    @property
+    def colors(self) -> np.ndarray | None:
+        """The uint32 array of shape=(N,) of the ARGB vertex colors."""
+        return self.__colors
+
+    @colors.setter
+    def colors(self, colors: npt.ArrayLike | None) -> None:
+        self.__colors = None if colors is None else np.ascontiguousarray(colors, np.uint32).reshape(-1)
+        self.changed()
+
+    @property
+    def textures(self) -> np.ndarray | None:
+        """The float32 array of shape=(N, 2) of the texture coordinates."""
+        return self.__textures
+
+    @textures.setter
+    def textures(self, textures: npt.ArrayLike | None) -> None:
+        self.__textures = None if textures is None else np.ascontiguousarray(textures, np.float32).reshape(-1, 2)
+        self.changed()
+
+    @property
+    def indices(self) -> np.ndarray | None:
+        """The uint16 array of the vertex indices."""
+        return self.__indices
+
+    @indices.setter
+    def indices(self, indices: npt.ArrayLike | None) -> None:
+        self.__indices = None if indices is None else np.ascontiguousarray(indices, np.uint16).reshape(-1)
+        self.changed()
+
+    @property
+    def version(self) -> int:
+        """A counter that changes whenever the arrays change."""
+        return self._revision
+
+    def changed(self) -> None:
+        """Marks the arrays as changed. Call this after modifying the arrays in place."""
+        self._is_dirty = True
+
+    def __build_vertices(self) -> None:
+        key = (self._revision, self.mode, self.offset.fX, self.offset.fY)
+        if key != self.__vertices_key:
+            self.__vertices = skia.Vertices(
+                self.mode, self.__positions, self.__textures, self.__colors, self.__indices, self.offset
+            )
+            self.__vertices_key = key
+
+    def on_draw(self, canvas: skia.Canvas) -> None:
+        canvas.drawVertices(self.__vertices, self.blend_mode, self.style.fill_paint)
+
+    def _transform_and_draw(self, canvas: skia.Canvas) -> None:
+        self.__build_vertices()
+        super()._transform_and_draw(canvas)
+
+    def get_bounds(self, transformed: bool = False) -> skia.Rect:
+        self.__build_vertices()
+        bounds = self.__vertices.bounds()
+        if transformed:
+            return self.mat.mapRect(bounds, skia.ApplyPerspectiveClip.kNo)
+        return bounds
+
+
+class ParticleSystem(Entity):
+    """
+    A large number of particles that are spawned, simulated and drawn natively by :class:`skia.ParticleSystem`, with
+    the ``fill_paint``. The system is advanced by ``1 / fps`` of the scene once per frame, in :meth:`draw`. Queries like
+    :meth:`get_bounds` before that, for example for occlusion culling, see the particles of the previous frame.
+
+    :ivar system: The native particle system. Its ``emitter``, ``gravity``, ``drag`` and attractors can be changed at
+        any time.
+    :ivar sprite: The image drawn for each particle. If ``None``, each particle is drawn as a square.
+    :ivar size: The side of the squares drawn when *sprite* is ``None``.
+    :ivar sampling: The sampling options for *sprite*.
+    """
+
+    def __init__(
+        self,
+        capacity: int = 10000,
+        sprite: skia.Image | None = None,
+        size: float = 4,
+        seed: int = 0,
+        **kwargs: Any,
+    ):
+        """
+        :param capacity: The maximum number of live particles.
+        :param sprite: The image drawn for each particle.
+        :param size: The side of the squares drawn when *sprite* is ``None``.
+        :param seed: The seed used to spawn particles.
+        """
+        super().__init__(**kwargs)
+        self.system: skia.ParticleSystem = skia.ParticleSystem(capacity, seed)
+        self.sprite: skia.Image | None = sprite
+        self.size: float = size
+        self.sampling: skia.SamplingOptions = skia.SamplingOptions(skia.FilterMode.kLinear)
+        self.__frame_number: int | None = None
+
+    @property
+    def emitter(self) -> skia.ParticleSystem.Emitter:
+        """The emitter of :attr:`system`."""
+        return self.system.emitter
+
+    def step(self, dt: float) -> None:
+        """Advances the particles by *dt* seconds."""
+        self.system.step(dt)
+        self._is_dirty = True
+
+    def __advance(self) -> None:
+        """Steps the particles once for every frame of the scene since the last step."""
+        if self._scene is None:
+            return
+        frame_number = self._scene.frame_number
+        frames = 1 if self.__frame_number is None else frame_number - self.__frame_number
+        self.__frame_number = frame_number
+        if frames > 0:
+            self.step(frames / self._scene.fps)
+
+    def on_draw(self, canvas: skia.Canvas) -> None:
+        canvas.translate(*self.offset)
+        self.system.draw(canvas, self.style.fill_paint, self.sprite, self.size, self.sampling)
+
+    def draw(self, canvas: skia.Canvas | None = None) -> None:
+        self.__advance()  # the particles must move before they are culled
+        super().draw(canvas)
+
+    def get_bounds(self, transformed: bool = False) -> skia.Rect:
+        bounds = self.system.bounds(self.sprite, self.size).makeOffset(self.offset)
+        if transformed:
+            return self.mat.mapRect(bounds, skia.ApplyPerspectiveClip.kNo)
+        return bounds
+
+
 class Patch(Entity):
     """A [Coons patch](https://en.wikipedia.org/wiki/Coons_patch) drawn with the ``fill_paint``."""
 
@@ -133,6 +322,8 @@ class BackDrop(Entity):
     Applies a backdrop filter to the content behind the entity. The ``stroke_paint`` and ``fill_paint`` are ignored.
     """
 
+    cullable = False
+
     def __init__(self, filter: skia.ImageFilter, clip: ClipLike | None = None, **kwargs: Any):
         """
         :param filter: The image filter to apply.
@@ -146,7 +337,7 @@ class BackDrop(Entity):
         if self.style.nothing_to_draw():
             return
         save_count = canvas.save()
-        canvas.concat(self.total_transformation)
+        canvas.concat(self._world_matrix())
         self.style.apply_clip(canvas)
 
         optimization = self.style.optimization
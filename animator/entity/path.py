@@ -22,9 +22,15 @@ class PathEntity(Entity):
         in subclasses.
     :ivar preserve_stroke: Whether the stroke width should be preserved when scaling the entity.
     :ivar scale_stroke_width: Whether the stroke width should be scaled uniformly when *preserve_stroke* is ``True``.
+
+    Set :attr:`Entity.cache_content` to ``True`` for a path entity that is drawn many times without changing, to replay
+    it as a recorded picture. The cache is recorded again when the path is rebuilt or modified in place, or when the
+    style, *offset* or stroke options change. Subclasses whose :meth:`do_fill` or :meth:`do_stroke` depend on any other
+    state must extend :meth:`_cache_key` with it, which is also needed for :attr:`Entity.complete_cache_key`.
     """
 
     _observed_attrs: set[str] = set()
+    complete_cache_key = True
 
     def __init__(self, **kwargs: Any) -> None:
         super().__init__(**kwargs)
@@ -34,6 +40,7 @@ class PathEntity(Entity):
         self.__path_texts: WeakSet[TextOnPath] = WeakSet()
 
         self.__path: skia.Path = skia.Path()
+        self.__path_generation: int = self.__path.getGenerationID()
         self.__old_attrs: dict[str, Any] = {}
         self.__old_offset: skia.Point = skia.Point(*self.offset)
 
@@ -48,7 +55,8 @@ class PathEntity(Entity):
 
     @property
     def path(self) -> skia.Path:
-        """The internal path."""
+        """The internal path. It can be modified in place; the change is detected through the generation ID of the path,
+        which invalidates the cached content (see :attr:`Entity.cache_content`) and bounds."""
         return self.__path
 
     @property
@@ -118,10 +126,28 @@ class PathEntity(Entity):
             mat = self.mat
         self.__build_path()
         self.__path.transform(mat, skia.ApplyPerspectiveClip.kNo)
+        self._mark_dirty_content()
         if reset:
             self.mat.reset()
         return self
 
+    def __check_path(self) -> None:
+        """Build the path if necessary, and mark the content as changed if the path was modified in place."""
+        self.__build_path()
+        generation = self.__path.getGenerationID()
+        if generation != self.__path_generation:
+            self.__path_generation = generation
+            self._mark_dirty_content()
+
+    def _mark_dirty_content(self) -> None:
+        """
+        Mark the content of this entity as changed after the path was modified in place, without rebuilding the path
+        (which :meth:`_mark_dirty` would do). This invalidates the cached content, bounds and the path texts.
+        """
+        self._revision += 1
+        for text in self.__path_texts:
+            text._is_dirty = True
+
     def do_stroke(self, canvas: skia.Canvas) -> None:
         """Draw the stroke."""
         if self.preserve_stroke:
@@ -146,6 +172,25 @@ class PathEntity(Entity):
         self.__build_path()
         super().on_draw(canvas)
 
+    def _cache_key(self) -> tuple:
+        self.__check_path()
+        return super()._cache_key() + (self.preserve_stroke, self.scale_stroke_width)
+
+    @property
+    def world_bounds(self) -> skia.Rect:
+        self.__check_path()
+        return super().world_bounds
+
+    def _content_uses_matrix(self) -> bool:
+        return self.preserve_stroke
+
+    def _opaque_rect(self) -> skia.Rect | None:
+        if not self.style.is_fill_opaque():
+            return None
+        self.__build_path()
+        rect = self.__path.isRect()
+        return None if rect is None else rect[0]
+
     def get_bounds(self, transformed: bool = False) -> skia.Rect:
         self.__build_path()
         if transformed:
@@ -155,15 +200,23 @@ class PathEntity(Entity):
 
 
 class Path(PathEntity):
+    """An entity that draws an arbitrary path.
+
+    :ivar shape: The path that is drawn. Assigning a new path, for example from a :class:`Timeline`, rebuilds the
+        entity.
+    """
+
+    _observed_attrs = {'shape'}
+
     def __init__(self, path: skia.Path | str, **kwargs: Any) -> None:
         """
         :param path: The path. If a string is passed, it is parsed as an SVG path.
         """
         super().__init__(**kwargs)
-        self.__svg_path = skia.ParsePath.FromSVGString(path) if isinstance(path, str) else path
+        self.shape: skia.Path = skia.ParsePath.FromSVGString(path) if isinstance(path, str) else path
 
     def on_build_path(self) -> None:
-        self.path.addPath(self.__svg_path)
+        self.path.addPath(self.shape)
 
 
 class Circle(PathEntity):
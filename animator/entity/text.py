@@ -15,8 +15,29 @@ if TYPE_CHECKING:
     _TextStyle = TextStyle | skia.textlayout.TextStyle
 
 
+def _font_key(font: skia.Font) -> tuple:
+    """The state of *font* that affects how text is measured and drawn."""
+    return (
+        font.getTypefaceOrDefault().uniqueID(),
+        font.getSize(),
+        font.getScaleX(),
+        font.getSkewX(),
+        font.getEdging(),
+        font.getHinting(),
+        font.isEmbolden(),
+        font.isSubpixel(),
+        font.isLinearMetrics(),
+        font.isBaselineSnap(),
+        font.isForceAutoHinting(),
+        font.isEmbeddedBitmaps(),
+    )
+
+
 class TextEntity(Entity):
-    """Base class for entities that show text."""
+    """Base class for entities that show text. The entity is marked dirty when :attr:`text` or :attr:`font_style` is
+    set, or when the font is modified in place, so that the cached content and bounds are updated."""
+
+    complete_cache_key = True
 
     def __init__(
         self,
@@ -32,11 +53,33 @@ class TextEntity(Entity):
         """
         super().__init__(**kwargs)
         self.font_style: FontStyle = FontStyle(font_name, font_size, font_style)
+        self.__font_key: tuple = _font_key(self.font_style.font)
         if 'paint_style' not in kwargs:
             self.style.paint_style = Style.PaintStyle.FILL_ONLY
         if 'fill_color' not in kwargs:
             self.style.set_fill_color_or_shader(FontStyle.COLOR)
 
+    def __setattr__(self, __name: str, __value: Any) -> None:
+        super().__setattr__(__name, __value)
+        if __name in {'text', 'font_style'}:
+            self._is_dirty = True
+
+    def _check_font(self) -> None:
+        """Marks the entity dirty if the font was modified in place since the last check."""
+        key = _font_key(self.font_style.font)
+        if key != self.__font_key:
+            self.__font_key = key
+            self._is_dirty = True
+
+    def _cache_key(self) -> tuple:
+        self._check_font()
+        return super()._cache_key()
+
+    @property
+    def world_bounds(self) -> skia.Rect:
+        self._check_font()
+        return super().world_bounds
+
 
 class SimpleText(TextEntity):
     """Simple text, shown simply!"""
@@ -80,7 +123,7 @@ class TextOnPath(TextEntity):
 
     def __setattr__(self, __name: str, __value: Any) -> None:
         super().__setattr__(__name, __value)
-        if __name in {'text', 'text_offset'}:
+        if __name == 'text_offset':
             self._is_dirty = True
 
     def __build_blob(self) -> None:
@@ -262,6 +305,7 @@ class Text(Entity):
                 bounds = obj.get_bounds()
                 bounds.outset(margin, margin)
                 obj.pos.set(box.rect.fLeft - bounds.fLeft, box.rect.fTop - bounds.fTop)
+                obj._invalidate_world()  # the paragraph may be laid out while drawing
             self._is_dirty = False
 
     def on_draw(self, canvas: skia.Canvas) -> None:
@@ -40,6 +40,20 @@ def _calculate_path_effect_needs(effect: skia.PathEffect) -> tuple[bool, bool]:
     return bool(types & __stroke), bool(types & __fill)
 
 
+def _is_paint_opaque(paint: skia.Paint) -> bool:
+    """Whether anything drawn with *paint* completely covers the pixels behind it."""
+    shader = paint.getShader()
+    return (
+        paint.getAlpha() == 255
+        and (shader is None or shader.isOpaque())
+        and paint.getColorFilter() is None
+        and paint.getMaskFilter() is None
+        and paint.getImageFilter() is None
+        and paint.getPathEffect() is None
+        and paint.asBlendMode() in (skia.BlendMode.kSrcOver, skia.BlendMode.kSrc)
+    )
+
+
 class Style:
     """
     The style of an entity. This class initializes with the default style values, which can be changed.
@@ -110,6 +124,13 @@ class Style:
         self.paint_style: Style.PaintStyle = Style.PaintStyle.FILL_THEN_STROKE
         self.optimization: Style.FinalPaintOptimization = Style.FinalPaintOptimization.OPACITY_ONLY
 
+        self.__revision: int = 0
+        self.__old_fill_paint: skia.Paint | None = None
+        self.__old_stroke_paint: skia.Paint | None = None
+        self.__old_paint_style: Style.PaintStyle | None = None
+        self.__final_revision: int = 0
+        self.__old_final_state: tuple | None = None
+
     @property
     def fill_paint(self) -> skia.Paint:
         """The paint used to fill the entity."""
@@ -125,6 +146,35 @@ class Style:
         """The final paint used to draw the entity."""
         return self.__final_paint
 
+    @property
+    def revision(self) -> int:
+        """
+        A number that changes whenever ``fill_paint``, ``stroke_paint`` or ``paint_style`` changes, including when the
+        paints are modified directly. Used to invalidate content cached by entities.
+        """
+        if (
+            self.__old_paint_style != self.paint_style
+            or self.__old_fill_paint != self.__fill_paint
+            or self.__old_stroke_paint != self.__stroke_paint
+        ):
+            self.__revision += 1
+            self.__old_fill_paint = skia.Paint(self.__fill_paint)
+            self.__old_stroke_paint = skia.Paint(self.__stroke_paint)
+            self.__old_paint_style = self.paint_style
+        return self.__revision
+
+    @property
+    def final_revision(self) -> int:
+        """
+        A number that changes whenever ``final_paint``, ``optimization`` or ``clip`` changes, including when the final
+        paint is modified directly. Used to detect changes in the way an entity is composited.
+        """
+        old = self.__old_final_state
+        if old is None or old[0] != self.__final_paint or old[1] != self.optimization or old[2] is not self.clip:
+            self.__final_revision += 1
+            self.__old_final_state = (skia.Paint(self.__final_paint), self.optimization, self.clip)
+        return self.__final_revision
+
     @property
     def anti_alias(self) -> bool:
         """Whether the entity is anti-aliased."""
@@ -430,6 +480,10 @@ class Style:
         style.__final_paint = skia.Paint(self.__final_paint)
         style.paint_style = self.paint_style
         style.optimization = self.optimization
+        style.__revision = 0
+        style.__old_fill_paint = style.__old_stroke_paint = style.__old_paint_style = None
+        style.__final_revision = 0
+        style.__old_final_state = None
         return style
 
     def nothing_to_draw(self) -> bool:
@@ -441,6 +495,27 @@ class Style:
             return self.__final_paint.getAlpha() == 0
         return self.__final_paint.nothingToDraw()
 
+    def is_layer_opaque(self) -> bool:
+        """Returns ``True`` if the clip and ``final_paint`` keep opaque content opaque, that is, the clip is ``None``
+        and ``final_paint`` (if it is applied) has full alpha, no filters and blends with src-over."""
+        if self.clip is not None:
+            return False
+        if self.optimization == Style.FinalPaintOptimization.NONE:
+            return True
+        if self.optimization == Style.FinalPaintOptimization.OPACITY_ONLY:
+            return self.__final_paint.getAlpha() == 255
+        return _is_paint_opaque(self.__final_paint)
+
+    def is_fill_opaque(self) -> bool:
+        """Returns ``True`` if the fill completely hides what is behind it, that is, it is drawn with an opaque color or
+        shader, without any filter or path effect, and blends with src-over, and :meth:`is_layer_opaque` is ``True``.
+        This is used to skip entities hidden behind opaque ones (see :attr:`Scene.occlusion_culling`)."""
+        return (
+            self.paint_style != Style.PaintStyle.STROKE_ONLY
+            and _is_paint_opaque(self.__fill_paint)
+            and self.is_layer_opaque()
+        )
+
     def apply_clip(self, canvas: skia.Canvas) -> None:
         """Apply the clip to the canvas."""
         if self.clip is None:
@@ -192,6 +192,8 @@ __all__ = (
     'norm',
     'random',
     'noise',
+    'noiseDetail',
+    'noiseSeed',
 )
 
 __scene: Scene = None
@@ -294,8 +296,7 @@ __color_mode: int = RGB
 __color_max: Tuple[float, float, float, float] = (255, 255, 255, 255)
 __tint: skia.ColorFilter | None = None
 __curve_tension: float = 1
-__perlin_octave: int = 4
-__perlin_amp_falloff: float = 0.5
+__noise: skia.Noise = skia.Noise(rnd.getrandbits(64), skia.Noise.Type.kValue, 4, 0.5)
 
 
 @overload
@@ -305,12 +306,13 @@ def size(scene: Scene) -> None:
 
 @overload
 def size(width: int, height: int) -> None:
-    """Set the size of the window and initialize the internal scene."""
+    """Set the size of the window and initialize the internal scene. The scene draws in BGRA order, so that its frames
+    can be shown by OpenCV without conversion."""
 
 
 def size(w: int | Scene = 100, h: int | None = 100) -> None:
     global __scene, __canvas
-    __scene = w if isinstance(w, Scene) else Scene(w, h)
+    __scene = w if isinstance(w, Scene) else Scene(w, h, color_type=skia.ColorType.kBGRA_8888_ColorType)
     pvars.width = __scene.width
     pvars.height = __scene.height
     __canvas = __scene.canvas
@@ -363,7 +365,10 @@ def draw(f: Callable[[], bool | None]) -> None:
     start_time = time.time()
     while not f() and __looping:
         pvars.pmouseX, pvars.pmouseY = pvars.mouseX, pvars.mouseY
-        cv2.imshow(__title, cv2.cvtColor(__scene.frame, cv2.COLOR_RGBA2BGR))
+        if __scene.color_type == skia.ColorType.kBGRA_8888_ColorType:
+            cv2.imshow(__title, __scene.frame)
+        else:
+            cv2.imshow(__title, cv2.cvtColor(__scene.frame, cv2.COLOR_RGBA2BGR))
         key_code = cv2.waitKey(__frame_wait) & 0xFF
         pvars.keyPressed_ = key_code != 0xFF
         pvars.keyCode, pvars.key = key_code, chr(key_code)
@@ -876,50 +881,23 @@ def random(a: float = 1, b: float | None = None) -> float:
     return rnd.random() * (b - a) + a
 
 
-# This is the same algorithm as implemented in Processing with variables substituted with corresponding magic numbers :)
-__perlin = tuple(rnd.random() for _ in range(4096))
-__perlin_cos = tuple(0.5 * (1 - math.cos(i * 0.008726646259971648)) for i in range(360))
+def noise(x: float, y: float = 0, z: float = 0) -> float:
+    """Returns perlin noise at a point (*x*, *y*, *z*). This is the same algorithm as implemented in Processing,
+    evaluated natively by :class:`skia.Noise`, which can also fill whole arrays at once."""
+    return __noise(x, y, z)
 
 
-def noise(x: float, y: float = 0, z: float = 0) -> float:
-    """Returns perlin noise at a point (*x*, *y*, *z*)."""
-    x, y, z = abs(x), abs(y), abs(z)
-    xi, yi, zi = int(x), int(y), int(z)
-    xf, yf, zf = x - xi, y - yi, z - zi
-    r, ampl = 0.0, 0.5
-    for i in range(__perlin_octave):
-        of = xi + (yi << 4) + (zi << 8)
-        rxf, ryf = __perlin_cos[int(xf * 360)], __perlin_cos[int(yf * 360)]
-        n1 = __perlin[of & 4095]
-        n1 += rxf * (__perlin[(of + 1) & 4095] - n1)
-        n2 = __perlin[(of + 16) & 4095]
-        n2 += rxf * (__perlin[(of + 17) & 4095] - n2)
-        n1 += ryf * (n2 - n1)
-        of += 256
-        n2 = __perlin[of & 4095]
-        n2 += rxf * (__perlin[(of + 1) & 4095] - n2)
-        n3 = __perlin[(of + 16) & 4095]
-        n3 += rxf * (__perlin[(of + 17) & 4095] - n3)
-        n2 += ryf * (n3 - n2)
-        n1 += __perlin_cos[int(zf * 360)] * (n2 - n1)
-        r += n1 * ampl
-        ampl *= __perlin_amp_falloff
-        xi <<= 1
-        xf *= 2
-        if xf >= 1:
-            xi += 1
-            xf -= 1
-        yi <<= 1
-        yf *= 2
-        if yf >= 1:
-            yi += 1
-            yf -= 1
-        zi <<= 1
-        zf *= 2
-        if zf >= 1:
-            zi += 1
-            zf -= 1
-    return r
+def noiseDetail(lod: int, falloff: float | None = None) -> None:
+    """Sets the number of octaves (*lod*) and, optionally, the amplitude *falloff* of each octave of :func:`noise`."""
+    __noise.octaves = lod
+    if falloff is not None:
+        __noise.falloff = falloff
+
+
+def noiseSeed(seed: int) -> None:
+    """Sets the seed of :func:`noise`, so that it returns the same values every time the program is run."""
+    global __noise
+    __noise = skia.Noise(seed & 0xFFFFFFFFFFFFFFFF, skia.Noise.Type.kValue, __noise.octaves, __noise.falloff)
 
 
 def _get_scene() -> Scene:
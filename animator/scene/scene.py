@@ -1,13 +1,21 @@
 from __future__ import annotations
 
+import itertools
+import os
 import re
+import shutil
+import subprocess
+import tempfile
+import threading
+from concurrent.futures import Future, ThreadPoolExecutor
 from contextlib import contextmanager
 from pathlib import Path
-from typing import Callable, Iterator, TypeVar
+from typing import IO, Callable, Iterator, Sequence, TypeVar
 
 import numpy as np
 
 from animator import skia
+from animator.anim.timeline import Timeline
 from animator.display import DisplayManager
 from animator.entity import Entity
 from animator.entity.entity_list import EntityList
@@ -42,6 +50,12 @@ _ext2format: dict[str, skia.EncodedImageFormat] = {
     'webp': skia.EncodedImageFormat.kWEBP,
 }
 _clear_paint: skia.Paint = skia.Paint(blendMode=skia.BlendMode.kClear)
+_world_epochs: Iterator[int] = itertools.count(1)  # shared by all scenes, so that an epoch is never reused
+_MAX_OCCLUDERS: int = 16  # only the largest opaque rectangles are kept to test the entities behind them
+_color_type2pix_fmt: dict[skia.ColorType, str] = {
+    skia.ColorType.kRGBA_8888_ColorType: 'rgba',
+    skia.ColorType.kBGRA_8888_ColorType: 'bgra',
+}
 
 
 class Scene:
@@ -51,13 +65,47 @@ class Scene:
     :ivar width: The width of the frame/scene.
     :ivar height: The height of the frame/scene.
     :ivar fps: The FPS used for animations.
-    :ivar frame: The internal frame (array) used for drawing. The data type is in RGBA format.
+    :ivar frame: The internal frame (array) used for drawing. The channels are in the order given by
+        :attr:`color_type`.
+    :ivar color_type: The color type of :attr:`frame`, either :attr:`skia.ColorType.kRGBA_8888_ColorType` or
+        :attr:`skia.ColorType.kBGRA_8888_ColorType`.
+    :ivar frame_number: The number of the current frame, starting from 0. It is incremented every time the scene is
+        updated, and is ``-1`` before the first update.
     :ivar canvas: The :class:`skia.Canvas` used for drawing.
     :ivar bgcolor: The background color of the scene. This is used when clearing the scene after each frame.
+    :ivar incremental: Whether :meth:`update` only redraws the parts of the frame that changed. In this mode, every
+        entity is recorded into a :class:`skia.Picture` to find its device bounds, and an entity whose state (see
+        :meth:`Entity._draw_state`) or bounds changed damages both its old and new bounds. Entities without a
+        :attr:`Entity.complete_cache_key`, like images and custom entities, damage their bounds in every frame. The
+        frame is then cleared and redrawn only inside the damaged region, by the entities that intersect it. Since the
+        entities are still recorded in every frame, this costs more Python and recording work than a plain update. It
+        only saves the rasterization outside of the damaged region, so it helps when small parts of a large or expensive
+        frame change. The update function must not draw on the canvas directly; call :meth:`invalidate` after doing so.
+    :ivar damage: The region of the frame, in pixels, that was redrawn by the last :meth:`update`. This is the whole
+        frame unless :attr:`incremental` is ``True``. Consumers of the frames may use it to skip unchanged pixels.
+    :ivar drawn_count: The number of entities drawn in the last frame.
+    :ivar culled_count: The number of entities, or groups with all their descendants, that were skipped in the last
+        frame because they were outside of the clip (see :attr:`Entity.cullable`).
+    :ivar occlusion_culling: Whether :meth:`update` skips top level entities that are completely hidden behind opaque
+        entities with a higher z-index. Before drawing, the entities are visited from front to back, collecting the
+        opaque rectangles of entities drawn with opaque paints (see :meth:`Style.is_fill_opaque`), and an entity is
+        skipped if its bounds, including its descendants, are inside one of them. In :attr:`incremental` mode, the
+        hidden entities are not recorded either, and keep their bounds from the last frame they were visible in.
+    :ivar occluded_count: The number of top level entities that were skipped in the last frame because they were
+        hidden behind opaque entities.
+    :ivar timelines: The :class:`Timeline` objects that are applied at the time of the current frame (``frame_number /
+        fps``) before the update function is called.
+    :ivar _world_epoch: A number identifying the current draw pass, or ``0`` outside of one. Entities check their cached
+        world matrix only once per draw pass (see :meth:`Entity._world_matrix`).
     """
 
     def __init__(
-        self, width: int | str = 854, height: int = 480, fps: float = 30, scale: float | tuple[int, int] | str = 1
+        self,
+        width: int | str = 854,
+        height: int = 480,
+        fps: float = 30,
+        scale: float | tuple[int, int] | str = 1,
+        color_type: skia.ColorType = skia.ColorType.kN32_ColorType,
     ) -> None:
         """
         :param width: The width of the frame/scene or a string representing a resolution. Resolutions can be one of
@@ -71,7 +119,12 @@ class Scene:
             cause lag or not fit on the screen. This factor is used to scale the frame down. By specifying a value >1,
             the frame can also be scaled up. If the aspect ratio of the frame is different from that of the scene, the
             frame will be centered.
+        :param color_type: The channel order of :attr:`frame`, either :attr:`skia.ColorType.kRGBA_8888_ColorType` or
+            :attr:`skia.ColorType.kBGRA_8888_ColorType`. The default is the native order of the platform, which is the
+            fastest to draw into. Use ``kBGRA_8888_ColorType`` to pass the frames to OpenCV without conversion.
         """
+        if color_type not in _color_type2pix_fmt:
+            raise ValueError(f'Unsupported color type: {color_type}')
         if isinstance(width, str):
             width = re.sub(r'[\W+]+', '', width.lower())
             width, height = _name2px[width]
@@ -85,19 +138,33 @@ class Scene:
         else:
             frame_width = int(width * scale)
             frame_height = int(height * scale)
+        self.color_type: skia.ColorType = color_type
         self.frame: np.ndarray = np.zeros(shape=(frame_height, frame_width, 4), dtype=np.uint8)
-        self.canvas = skia.Canvas(self.frame)
+        self.canvas = skia.Canvas(self.frame, color_type)
         scale = min(frame_width / width, frame_height / height)
         self.canvas.translate((frame_width - width * scale) / 2, (frame_height - height * scale) / 2)
         self.canvas.scale(scale, scale)
 
         self.fps: float = fps
+        self.frame_number: int = -1
 
         self.entities: EntityList = EntityList()
+        self.timelines: list[Timeline] = []
+        self.drawn_count: int = 0
+        self.culled_count: int = 0
+        self.occlusion_culling: bool = False
+        self.occluded_count: int = 0
         self.bgcolor: skia.Color4f = skia.Color4f.kBlack
         self.__context2d: Context2d | None = None
 
         self.__update_func: Callable[[], bool | None] | None = None
+        self._world_epoch: int = 0
+
+        self.incremental: bool = False
+        self.damage: skia.Region = skia.Region(skia.IRect.MakeWH(frame_width, frame_height))
+        self.__entity_records: dict[Entity, tuple[tuple | None, skia.IRect]] | None = None
+        self.__entity_order: list[Entity] = []
+        self.__old_bgcolor: skia.Color4f = skia.Color4f(self.bgcolor)
 
     def clear(self) -> None:
         """Clears the frame and fills it with transparency."""
@@ -146,12 +213,141 @@ class Scene:
 
         :return: ``False`` if the animation should stop, ``True`` otherwise.
         """
+        self.frame_number += 1
+        self.drawn_count = self.culled_count = self.occluded_count = 0
+        for timeline in self.timelines:
+            timeline.apply(self.frame_number / self.fps)
+        if self.incremental:
+            more = True if self.__update_func is None else not self.__update_func()
+            with self.__draw_pass():
+                self.__draw_damaged()
+            return more
         self.clear_with_bgcolor()
         more = True if self.__update_func is None else not self.__update_func()
-        for entity in self.entities:
-            entity.draw()
+        with self.__draw_pass():
+            occluded = self.__find_occluded() if self.occlusion_culling else set()
+            for entity in self.entities:
+                if entity in occluded:
+                    self.occluded_count += 1
+                else:
+                    entity.draw()
+        self.damage.setRect(skia.IRect.MakeWH(self.frame.shape[1], self.frame.shape[0]))
+        self.__entity_records = None
+        return more
+
+    @contextmanager
+    def __draw_pass(self) -> Iterator[None]:
+        """Starts a new :attr:`_world_epoch` while the entities are drawn."""
+        self._world_epoch = next(_world_epochs)
+        try:
+            yield
+        finally:
+            self._world_epoch = 0
+
+    def update_tiled(self, tile_size: int | tuple[int, int] = 256, workers: int = 0) -> bool:
+        """Same as :meth:`update`, but the frame is rasterized in parallel. The drawing commands of the frame are
+        recorded into a :class:`skia.Picture`, which is then replayed into tiles of :attr:`frame` on native worker
+        threads with :func:`skia.renderPictureTiled`. The result is the same as that of :meth:`update`. This helps
+        with expensive frames, like ones with large blurs or runtime shaders, or very large frames.
+
+        :param tile_size: The size of each tile, either a single number or a tuple of (width, height).
+        :param workers: The number of worker threads. If ``0``, the number of CPUs is used.
+        :return: ``False`` if the animation should stop, ``True`` otherwise.
+        """
+        tile_width, tile_height = (tile_size, tile_size) if isinstance(tile_size, int) else tile_size
+        frame_height, frame_width = self.frame.shape[:2]
+        recorder = skia.PictureRecorder()
+        canvas = recorder.beginRecording(skia.Rect.MakeWH(frame_width, frame_height), skia.RTreeFactory())
+        canvas.setMatrix(self.canvas.getTotalMatrix())
+        incremental, self.incremental = self.incremental, False
+        try:
+            with self._redirect(canvas):
+                more = self.update()
+        finally:
+            self.incremental = incremental
+        skia.renderPictureTiled(
+            recorder.finishRecordingAsPicture(), self.frame, tile_width, tile_height, workers, self.color_type
+        )
         return more
 
+    def invalidate(self) -> None:
+        """Marks the whole frame as damaged, so that the next incremental :meth:`update` redraws everything."""
+        self.__entity_records = None
+
+    def __find_occluded(self) -> set[Entity]:
+        """Visits the top level entities from front to back, and returns the ones hidden behind opaque entities."""
+        matrix = self.canvas.getTotalMatrix()
+        occluders: list[skia.Rect] = []
+        occluded: set[Entity] = set()
+        for entity in reversed(self.entities):
+            if occluders:
+                bounds = entity._tree_bounds()
+                if bounds is not None and not bounds.isEmpty():
+                    device = matrix.mapRect(bounds)
+                    if any(occluder.contains(device) for occluder in occluders):
+                        occluded.add(entity)
+                        continue
+            occluders.extend(entity._opaque_rects(matrix))
+            if len(occluders) > _MAX_OCCLUDERS:
+                occluders.sort(key=lambda rect: rect.width() * rect.height(), reverse=True)
+                del occluders[_MAX_OCCLUDERS:]
+        return occluded
+
+    def __draw_damaged(self) -> None:
+        """Records the entities, accumulates the damaged region into :attr:`damage` and redraws only that region."""
+        frame_bounds = skia.IRect.MakeWH(self.frame.shape[1], self.frame.shape[0])
+        matrix = self.canvas.getTotalMatrix()
+        records: dict[Entity, tuple[tuple | None, skia.IRect]] = {}
+        pictures: list[tuple[skia.Picture, skia.IRect]] = []
+        damage = skia.Region()
+        old_records = self.__entity_records
+        occluded = self.__find_occluded() if self.occlusion_culling else set()
+        for entity in self.entities:
+            if entity in occluded:  # hidden, so its pixels are covered by the entities in front of it anyway
+                self.occluded_count += 1
+                if old_records is not None and entity in old_records:
+                    records[entity] = old_records[entity]
+                continue
+            recorder = skia.PictureRecorder()
+            canvas = recorder.beginRecording(skia.Rect(frame_bounds), skia.RTreeFactory())
+            canvas.setMatrix(matrix)
+            entity.draw(canvas)
+            picture = recorder.finishRecordingAsPicture()
+            bounds = picture.cullRect().roundOut()
+            state = entity._draw_state()
+            if old_records is not None:
+                old = old_records.get(entity)
+                if old is None:
+                    damage |= bounds
+                elif state is None or old[0] != state or old[1] != bounds:
+                    damage |= old[1]
+                    damage |= bounds
+            records[entity] = state, bounds
+            pictures.append((picture, bounds))
+
+        if old_records is None or self.__entity_order != self.entities or self.__old_bgcolor != self.bgcolor:
+            damage.setRect(frame_bounds)
+        else:
+            for entity, (_, bounds) in old_records.items():
+                if entity not in records:
+                    damage |= bounds
+            damage &= frame_bounds
+        self.damage = damage
+        self.__entity_records = records
+        self.__entity_order = list(self.entities)
+        self.__old_bgcolor = skia.Color4f(self.bgcolor)
+        if damage.isEmpty():
+            return
+
+        save_count = self.canvas.save()
+        self.canvas.resetMatrix()
+        self.canvas.clipRegion(damage)
+        self.canvas.clear(self.bgcolor)
+        for picture, bounds in pictures:
+            if damage.intersects(bounds):
+                self.canvas.drawPicture(picture)
+        self.canvas.restoreToCount(save_count)
+
     def show_frame(self) -> None:
         """Displays the current frame."""
         manager = DisplayManager.get_best()(self)
@@ -163,33 +359,299 @@ class Scene:
         """Saves the current frame to a file.
 
         :param path: The path to the file. The path may contain a ``{}`` placeholder, which will be replaced with the
-            current frame number.
+            current frame number (see :attr:`frame_number`). Format specs like ``{:04}`` are also supported.
         :param quality: The quality of the image, between 0 and 100. Defaults to 100."""
-        path_obj = Path(path.format(0)).expanduser().resolve()
+        path_obj = Path(path.format(max(self.frame_number, 0))).expanduser().resolve()
         ext = path_obj.suffix[1:]
         try:
-            skia.Image.fromarray(self.frame, copy=False).save(str(path_obj), _ext2format[ext], quality)
+            skia.Image.fromarray(self.frame, self.color_type, copy=False).save(str(path_obj), _ext2format[ext], quality)
         except KeyError:
             raise ValueError(f'Unsupported file extension: {ext}')
 
-    def play_frames(self, delay: float | None = None, keep_open: bool = True) -> None:
+    def save_frames(
+        self, path: str, frames: int | None = None, quality: int = 100, workers: int = 0, max_pending: int = 0
+    ) -> int:
+        """Saves each frame of the animation to a separate image file. The frames are encoded and written by a
+        :class:`skia.ImageSequenceWriter` on background threads while the next frames are being rendered.
+
+        :param path: The path to the files. It must contain a ``{}`` placeholder (format specs like ``{:04}`` are
+            supported), which will be replaced with the frame number.
+        :param frames: The maximum number of frames to save. If ``None``, frames are saved until the update function
+            returns ``True``.
+        :param quality: The quality of the images, between 0 and 100. Defaults to 100.
+        :param workers: The number of encoder threads. If ``0``, the number of CPUs is used.
+        :param max_pending: The maximum number of frames waiting to be written before rendering is paused. If ``0``,
+            twice the number of workers is used.
+        :return: The number of frames saved.
+        """
+        ext = Path(path).suffix[1:]
+        try:
+            image_format = _ext2format[ext]
+        except KeyError:
+            raise ValueError(f'Unsupported file extension: {ext}')
+        count = 0
+        with skia.ImageSequenceWriter(image_format, quality, workers, max_pending) as writer:
+            while (frames is None or count < frames) and self.update():
+                path_str = str(Path(path.format(self.frame_number)).expanduser().resolve())
+                writer.write(self.frame, path_str, self.color_type)
+                count += 1
+        return count
+
+    def export_video(
+        self,
+        path: str,
+        frames: int | None = None,
+        codec: str | None = None,
+        pix_fmt: str = 'yuv420p',
+        ffmpeg_args: Sequence[str] = (),
+        ffmpeg: str = 'ffmpeg',
+        workers: int | None = None,
+    ) -> int:
+        """Exports the animation as a video by streaming the raw frames to an encoder process (``ffmpeg``) through a
+        pipe. No intermediate images are created, and the frames are written without copying. The encoder runs
+        concurrently with the rendering; if it falls behind, writing to the pipe blocks until it catches up.
+
+        :param path: The path to the output video. The container format is guessed from the extension by ``ffmpeg``.
+        :param frames: The maximum number of frames to export. If ``None``, frames are exported until the update
+            function returns ``True``.
+        :param codec: The video codec, like ``'libx264'`` or ``'libvpx-vp9'``. If ``None``, ``ffmpeg`` chooses one
+            based on the extension.
+        :param pix_fmt: The pixel format of the output video. ``'yuv420p'`` is the most compatible, but requires the
+            frame width and height to be even. Use ``'yuva420p'`` or ``'rgba'`` to keep transparency if the codec
+            supports it.
+        :param ffmpeg_args: Extra output arguments for ``ffmpeg``, like ``('-crf', '18')``.
+        :param ffmpeg: The name or path of the ``ffmpeg`` executable.
+        :param workers: If not ``None``, the frames are rendered in parallel with :meth:`render` using these many
+            workers (``0`` for the number of CPUs).
+        :return: The number of frames exported.
+        """
+        executable = shutil.which(ffmpeg)
+        if executable is None:
+            raise FileNotFoundError(f'Encoder not found: {ffmpeg}')
+        frame_height, frame_width = self.frame.shape[:2]
+        args = [
+            executable,
+            '-y',
+            '-loglevel',
+            'error',
+            '-f',
+            'rawvideo',
+            '-pix_fmt',
+            _color_type2pix_fmt[self.color_type],
+            '-s',
+            f'{frame_width}x{frame_height}',
+            '-r',
+            str(self.fps),
+            '-i',
+            '-',
+            '-an',
+        ]
+        if codec is not None:
+            args += ['-c:v', codec]
+        args += ['-pix_fmt', pix_fmt, *ffmpeg_args, str(Path(path).expanduser().resolve())]
+
+        # stderr goes to a file, since a full pipe would block ffmpeg while frames are still being written to it
+        stderr = tempfile.TemporaryFile()
+        process = subprocess.Popen(args, stdin=subprocess.PIPE, stderr=stderr)
+        assert process.stdin is not None
+        _grow_pipe(process.stdin, self.frame.nbytes)
+        count = 0
+        try:
+            try:
+                if workers is None:
+                    while (frames is None or count < frames) and self.update():
+                        process.stdin.write(memoryview(self.frame))
+                        count += 1
+                else:
+                    for frame in self.render(frames, workers):
+                        process.stdin.write(memoryview(frame))
+                        count += 1
+                process.stdin.close()
+            except BrokenPipeError:
+                pass  # the encoder exited early, its error is reported below
+        finally:
+            if not process.stdin.closed:
+                try:
+                    process.stdin.close()
+                except BrokenPipeError:
+                    pass
+            returncode = process.wait()
+            stderr.seek(0)
+            error = stderr.read()
+            stderr.close()
+        # only reached if rendering succeeded, so that an error while rendering is not replaced by the encoder's error
+        if returncode != 0:
+            raise RuntimeError(f'{ffmpeg} exited with code {returncode}: {error.decode(errors="replace")}')
+        return count
+
+    def play_frames(
+        self, delay: float | None = None, keep_open: bool = True, buffers: int = 1, drop_frames: bool = False
+    ) -> None:
         """Plays the animation by displaying each frame in the scene.
 
         :param delay: The delay between frames in seconds. If ``None``, the delay is set to ``1 / fps``. If ``0``, the
             animation is played as fast as possible.
         :param keep_open: Whether to keep the animation open after playing. To close the animation, press ``Esc`` or
             close the window.
+        :param buffers: The number of frame buffers. If ``1``, each frame is rendered into :attr:`frame` and then
+            displayed. If more than 1, the frames are rendered on a separate thread with :meth:`stream_frames`, so that
+            the next frames are rendered while the current one is displayed. The update function then runs on the
+            render thread, so it must not use GUI toolkits, and :attr:`incremental` updates are disabled.
+        :param drop_frames: Whether to skip to the newest rendered frame when displaying is slower than rendering.
+            Only used with multiple buffers.
         """
         if delay is None:
             delay = 1 / self.fps
         manager = DisplayManager.get_best()(self, delay)
-        while self.update() and manager.show_frame():
-            pass
+        if buffers <= 1:
+            while self.update() and manager.show_frame():
+                pass
+        else:
+            frames = self.stream_frames(buffers=buffers, drop=drop_frames)
+            try:
+                for frame in frames:
+                    manager.frame = frame
+                    if not manager.show_frame():
+                        break
+            finally:
+                frames.close()
+            np.copyto(self.frame, manager.frame)
+            manager.frame = self.frame
         if keep_open:
             while manager.show_frame():
                 pass
         manager.close()
 
+    def stream_frames(self, frames: int | None = None, buffers: int = 2, drop: bool = False) -> Iterator[np.ndarray]:
+        """Renders the animation on a separate thread, which updates the scene into the next buffer of a ring of frame
+        buffers while the caller displays or encodes the previous ones. The buffers are handed between the threads by a
+        lock-free :class:`skia.FrameRing`, and the render thread waits while every buffer holds a frame that was not
+        consumed yet.
+
+        Each buffer is a few frames behind, so :attr:`incremental` updates are disabled while streaming. The update
+        function runs on the render thread, so it must not use GUI toolkits that are bound to the main thread.
+
+        :param frames: The maximum number of frames to render. If ``None``, frames are rendered until the update
+            function returns ``True``.
+        :param buffers: The number of frame buffers, at least 2.
+        :param drop: If ``True``, only the newest rendered frame is returned and the older ones are skipped, so that a
+            consumer slower than the rendering does not fall behind. The render thread still waits for a free buffer.
+        :return: An iterator over the rendered frames, in order. Each frame is one of the buffers, with the same shape
+            and format as :attr:`frame`, and is only valid until the next frame is requested.
+        """
+        if buffers < 2:
+            raise ValueError('At least 2 buffers are needed.')
+        ring = skia.FrameRing(buffers)
+        matrix = self.canvas.getTotalMatrix()
+        arrays = [np.zeros_like(self.frame) for _ in range(buffers)]
+        canvases = [skia.Canvas(array, self.color_type) for array in arrays]
+        for canvas in canvases:
+            canvas.setMatrix(matrix)
+        errors: list[BaseException] = []
+
+        def produce() -> None:
+            nonlocal frames
+            try:
+                while frames is None or frames > 0:
+                    slot = ring.beginWrite()
+                    if slot < 0:
+                        break
+                    with self._redirect(canvases[slot]):
+                        if not self.update():
+                            break
+                    ring.endWrite()
+                    if frames is not None:
+                        frames -= 1
+            except BaseException as e:
+                errors.append(e)
+            finally:
+                ring.close()
+
+        incremental, self.incremental = self.incremental, False
+        thread = threading.Thread(target=produce, name=f'Scene_{id(self)}_render', daemon=True)
+        thread.start()
+        try:
+            while (slot := ring.acquire(drop)) >= 0:
+                yield arrays[slot]
+                ring.release()
+        finally:
+            ring.close()
+            thread.join()
+            self.incremental = incremental
+        if errors:
+            raise errors[0]
+
+    def render(self, frames: int | None = None, workers: int = 0, batch_size: int = 0) -> Iterator[np.ndarray]:
+        """Renders the animation offline, using multiple threads. For each frame, the scene is updated and its drawing
+        commands are recorded into a :class:`skia.Picture`, which are then rasterized in batches by a pool of native
+        worker threads that do not hold the GIL. Recording the next batch overlaps with rasterizing the current one.
+
+        Unlike :meth:`play_frames`, each frame is rasterized independently on a transparent frame, so the background
+        must be cleared in every frame (which :meth:`update` does by default).
+
+        :param frames: The maximum number of frames to render. If ``None``, frames are rendered until the update
+            function returns ``True``.
+        :param workers: The number of worker threads. If ``0``, the number of CPUs is used.
+        :param batch_size: The number of frames rasterized together. If ``0``, twice the number of workers is used.
+        :return: An iterator over the rendered frames, in order. Each frame is a new array with the same shape and
+            format as :attr:`frame`.
+        """
+        if workers <= 0:
+            workers = os.cpu_count() or 1
+        if batch_size <= 0:
+            batch_size = 2 * workers
+        frame_height, frame_width = self.frame.shape[:2]
+        bounds = skia.Rect.MakeWH(frame_width, frame_height)
+        matrix = self.canvas.getTotalMatrix()
+
+        def record_batch() -> list[skia.Picture]:
+            nonlocal frames
+            pictures: list[skia.Picture] = []
+            while len(pictures) < batch_size and (frames is None or frames > 0):
+                recorder = skia.PictureRecorder()
+                canvas = recorder.beginRecording(bounds)
+                canvas.setMatrix(matrix)
+                with self._redirect(canvas):
+                    more = self.update()
+                picture = recorder.finishRecordingAsPicture()
+                if not more:
+                    frames = 0
+                    break
+                pictures.append(picture)
+                if frames is not None:
+                    frames -= 1
+            return pictures
+
+        incremental, self.incremental = self.incremental, False  # every picture must contain the whole frame
+        try:
+            with ThreadPoolExecutor(1) as executor:
+                pending: Future[list[np.ndarray]] | None = None
+                while pictures := record_batch():
+                    future = executor.submit(
+                        skia.renderPictures, pictures, frame_width, frame_height, workers, self.color_type
+                    )
+                    if pending is not None:
+                        yield from pending.result()
+                    pending = future
+                if pending is not None:
+                    yield from pending.result()
+        finally:
+            self.incremental = incremental
+
+    @contextmanager
+    def _redirect(self, canvas: skia.Canvas) -> Iterator[skia.Canvas]:
+        """Temporarily redirects all drawing on the scene (including :attr:`context2d`) to *canvas*."""
+        scene_canvas = self.canvas
+        self.canvas = canvas
+        if self.__context2d is not None:
+            self.__context2d._canvas = canvas
+        try:
+            yield canvas
+        finally:
+            self.canvas = scene_canvas
+            if self.__context2d is not None:
+                self.__context2d._canvas = scene_canvas
+
     @contextmanager
     def quickdraw(self) -> Iterator[Context2d]:
         """A simple way to quickly draw something on the scene. This method clears the scene and returns a
@@ -246,4 +708,17 @@ class Scene:
     def _repr_png_(self) -> bytes:
         """Returns the current frame as a PNG image. This method is called when the scene is displayed in a Jupyter
         notebook."""
-        return skia.Image.fromarray(self.frame, copy=False).encodeToData().bytes()
+        return skia.Image.fromarray(self.frame, self.color_type, copy=False).encodeToData().bytes()
+
+
+def _grow_pipe(pipe: IO[bytes], size: int) -> None:
+    """Tries to grow the kernel buffer of *pipe* to hold *size* bytes, so that a whole frame can be written while the
+    encoder is still busy with the previous one. Only supported on Linux; does nothing elsewhere."""
+    try:
+        import fcntl
+
+        with open('/proc/sys/fs/pipe-max-size') as f:
+            size = min(size, int(f.read()))
+        fcntl.fcntl(pipe.fileno(), fcntl.F_SETPIPE_SZ, size)
+    except (ImportError, AttributeError, OSError, ValueError):
+        pass
@@ -24,6 +24,7 @@ __all__ = [
     "AlphaType",
     "ApplyPerspectiveClip",
     "AutoCanvasRestore",
+    "BBHFactory",
     "Bitmap",
     "BlendMode",
     "BlendModeCoeff",
@@ -71,6 +72,8 @@ __all__ = [
     "DashPathEffect",
     "Data",
     "DiscretePathEffect",
+    "Drawable",
+    "Easing",
     "EncodedImageFormat",
     "FilterMode",
     "Flattenable",
@@ -82,6 +85,7 @@ __all__ = [
     "FontParameters",
     "FontStyle",
     "FontStyleSet",
+    "FrameRing",
     "GradientShader",
     "HSVToColor",
     "HighContrastConfig",
@@ -93,6 +97,7 @@ __all__ = [
     "ImageFilter",
     "ImageFilters",
     "ImageInfo",
+    "ImageSequenceWriter",
     "Line2DPathEffect",
     "LumaColorFilter",
     "MakeNullCanvas",
@@ -103,10 +108,12 @@ __all__ = [
     "MipmapMode",
     "NamedGamut",
     "NamedTransferFn",
+    "Noise",
     "OpBuilder",
     "OverdrawColorFilter",
     "Paint",
     "ParsePath",
+    "ParticleSystem",
     "Path",
     "Path1DPathEffect",
     "Path2DPathEffect",
@@ -115,10 +122,12 @@ __all__ = [
     "PathEffect",
     "PathFillType",
     "PathMeasure",
+    "PathMorph",
     "PathOp",
     "PathSegmentMask",
     "PathVerb",
     "Picture",
+    "PictureRecorder",
     "PixelGeometry",
     "Pixmap",
     "Point",
@@ -128,6 +137,7 @@ __all__ = [
     "RGBToHSV",
     "RRect",
     "RSXform",
+    "RTreeFactory",
     "Rect",
     "Region",
     "RuntimeBlendBuilder",
@@ -151,6 +161,7 @@ __all__ = [
     "TextBlobBuilder",
     "TextEncoding",
     "TextUtils_Align",
+    "Timeline",
     "TileMode",
     "TrimPathEffect",
     "Typeface",
@@ -158,6 +169,8 @@ __all__ = [
     "YUVColorSpace",
     "cms",
     "kTileModeCount",
+    "renderPictureTiled",
+    "renderPictures",
     "sksl",
     "textlayout",
     "uniqueColor",
@@ -253,6 +266,14 @@ class AutoCanvasRestore:
     def restore(self) -> None: ...
     pass
 
+class BBHFactory:
+    """
+    Factory for the bounding box hierarchy (BBH) of a :py:class:`Picture`. A picture with a BBH only replays the
+    drawing commands that intersect the clip of the canvas it is drawn on.
+    """
+
+    pass
+
 class Bitmap:
     """
     :py:class:`Bitmap` describes a two-dimensional raster pixel array.
@@ -1057,6 +1078,25 @@ class Canvas:
     def concat(self, matrix: Matrix) -> None: ...
     def discard(self) -> None: ...
     def drawArc(self, oval: _Rect, startAngle: float, sweepAngle: float, useCenter: bool, paint: Paint) -> None: ...
+    @typing.overload
+    def drawAtlas(
+        self,
+        atlas: Image,
+        xform: numpy.ndarray | None,
+        tex: numpy.ndarray,
+        colors: numpy.ndarray | None,
+        mode: BlendMode,
+        sampling: SamplingOptions,
+        cullRect: _Rect | None = None,
+        paint: Paint | None = None,
+    ) -> None:
+        """
+        Draws a set of sprites from *atlas*, defined by *xform*, *tex*, and *colors* using *mode* and
+        *sampling*. *xform* is a float32 array of shape (N, 4) with the :py:class:`RSXform` values (scos, ssin,
+        tx, ty), *tex* is a float32 array of shape (N, 4) with the rects (left, top, right, bottom), and
+        *colors* is a uint32 array of ARGB colors. The arrays are used without copying.
+        """
+    @typing.overload
     def drawAtlas(
         self,
         atlas: Image,
@@ -1081,6 +1121,10 @@ class Canvas:
     def drawColor(self, color: _Color, mode: BlendMode = BlendMode.kSrcOver) -> None: ...
     def drawDRRect(self, outer: RRect, inner: RRect, paint: Paint) -> None: ...
     @typing.overload
+    def drawDrawable(self, drawable: Drawable, matrix: Matrix | None = None) -> None: ...
+    @typing.overload
+    def drawDrawable(self, drawable: Drawable, x: float, y: float) -> None: ...
+    @typing.overload
     def drawGlyphs(
         self,
         glyphs: list[int],
@@ -1096,6 +1140,16 @@ class Canvas:
         and *clusters* information.
         """
     @typing.overload
+    def drawGlyphs(
+        self, glyphs: numpy.ndarray, positions: numpy.ndarray, origin: _Point, font: Font, paint: Paint
+    ) -> None:
+        """
+        Draws *glyphs*, a uint16 array, relative to *origin* styled with *font* and *paint*. *positions* is a
+        float32 array, either of shape (N, 2) with the position of each glyph, or of shape (N, 4) with the
+        :py:class:`RSXform` values (scos, ssin, tx, ty) of each glyph, like the output of
+        :py:meth:`PathMeasure.sample` with ``rsxform=True``. The arrays are used without copying.
+        """
+    @typing.overload
     def drawGlyphs(self, glyphs: list[int], positions: list[_Point], origin: _Point, font: Font, paint: Paint) -> None:
         """Draws *glyphs*, at *positions* relative to *origin* styled with *font* and *paint*."""
     @typing.overload
@@ -1143,6 +1197,21 @@ class Canvas:
         """
         Draws the *paragraph* at the given *x* and *y* position.
         """
+    @typing.overload
+    def drawPatch(
+        self,
+        cubics: numpy.ndarray,
+        colors: numpy.ndarray | None,
+        texCoords: numpy.ndarray | None,
+        mode: BlendMode,
+        paint: Paint,
+    ) -> None:
+        """
+        Draws a Coons patch with the 12 points of *cubics*, the 4 corner *colors* and the 4 *texCoords*.
+        *cubics* and *texCoords* are float32 arrays of shape (N, 2), and *colors* is a uint32 array of ARGB
+        colors. The arrays are used without copying.
+        """
+    @typing.overload
     def drawPatch(
         self,
         cubics: typing.Sequence[_Point],
@@ -1157,6 +1226,13 @@ class Canvas:
     def drawPoint(self, p: _Point, paint: Paint) -> None: ...
     @typing.overload
     def drawPoint(self, x: float, y: float, paint: Paint) -> None: ...
+    @typing.overload
+    def drawPoints(self, mode: Canvas.PointMode, pts: numpy.ndarray, paint: Paint) -> None:
+        """
+        Draw the points in *pts*, a float32 array of shape (N, 2), with the specified *mode* and *paint*. The
+        array is used without copying.
+        """
+    @typing.overload
     def drawPoints(self, mode: Canvas.PointMode, pts: list[_Point], paint: Paint) -> None:
         """
         Draw a list of points, *pts*, with the specified *mode* and *paint*.
@@ -2084,6 +2160,175 @@ class DiscretePathEffect:
     def Make(segLength: float, dev: float, seedAssist: int = 0) -> PathEffect: ...
     pass
 
+class Drawable(Flattenable):
+    """
+    Base-class for objects that draw into :py:class:`Canvas`.
+
+    The object has a generation ID, which is guaranteed to be unique across all drawables. To allow for clients of
+    the drawable that may want to cache the results, the drawable must change its generation ID whenever its
+    internal state changes such that it will draw differently.
+    """
+
+    def approximateBytesUsed(self) -> int: ...
+    @typing.overload
+    def draw(self, canvas: Canvas, matrix: Matrix | None = None) -> None:
+        """
+        Draws into the specified content. The drawing sequence will be balanced upon return (i.e. the
+        ``saveLevel()`` on the canvas will match what it was when :py:meth:`draw` was called, and the current
+        matrix and clip settings will not be changed.
+        """
+    @typing.overload
+    def draw(self, canvas: Canvas, x: float, y: float) -> None: ...
+    def getBounds(self) -> Rect:
+        """
+        Return the (conservative) bounds of what the drawable will draw.
+        """
+    def getGenerationID(self) -> int:
+        """
+        Return a unique value for this instance. If two calls to this return the same value, it is presumed
+        that calling the :py:meth:`draw` method will render the same thing as well.
+        """
+    def makePictureSnapshot(self) -> Picture: ...
+    def notifyDrawingChanged(self) -> None:
+        """
+        Calling this invalidates the previous generation ID, and causes a new one to be computed the next time
+        :py:meth:`getGenerationID` is called.
+        """
+    pass
+
+class Easing:
+    """
+    A native easing function, which can be called with a single float, or with a numpy array to ease many values
+    in a single call. The curves are the same as those in :py:mod:`animator.anim.easing`.
+    """
+
+    class Type:
+        """
+        Members:
+
+          kLinear
+
+          kSinIn
+
+          kSinOut
+
+          kSinInOut
+
+          kCircIn
+
+          kCircOut
+
+          kCircInOut
+
+          kExpIn
+
+          kExpOut
+
+          kExpInOut
+
+          kBounceIn
+
+          kBounceOut
+
+          kBounceInOut
+
+          kPowIn
+
+          kPowOut
+
+          kPowInOut
+
+          kBackIn
+
+          kBackOut
+
+          kBackInOut
+
+          kElasticIn
+
+          kElasticOut
+
+          kElasticInOut
+
+          kQuadish
+
+          kBezier
+        """
+
+        def __eq__(self, other: object) -> bool: ...
+        def __getstate__(self) -> int: ...
+        def __hash__(self) -> int: ...
+        def __index__(self) -> int: ...
+        def __init__(self, value: int) -> None: ...
+        def __int__(self) -> int: ...
+        def __ne__(self, other: object) -> bool: ...
+        def __repr__(self) -> str: ...
+        def __setstate__(self, state: int) -> None: ...
+        @property
+        def name(self) -> str:
+            """
+            :type: str
+            """
+        @property
+        def value(self) -> int:
+            """
+            :type: int
+            """
+        __members__: dict  # value = {'kLinear': <Type.kLinear: 0>, 'kSinIn': <Type.kSinIn: 1>, 'kSinOut': <Type.kSinOut: 2>, 'kSinInOut': <Type.kSinInOut: 3>, 'kCircIn': <Type.kCircIn: 4>, 'kCircOut': <Type.kCircOut: 5>, 'kCircInOut': <Type.kCircInOut: 6>, 'kExpIn': <Type.kExpIn: 7>, 'kExpOut': <Type.kExpOut: 8>, 'kExpInOut': <Type.kExpInOut: 9>, 'kBounceIn': <Type.kBounceIn: 10>, 'kBounceOut': <Type.kBounceOut: 11>, 'kBounceInOut': <Type.kBounceInOut: 12>, 'kPowIn': <Type.kPowIn: 13>, 'kPowOut': <Type.kPowOut: 14>, 'kPowInOut': <Type.kPowInOut: 15>, 'kBackIn': <Type.kBackIn: 16>, 'kBackOut': <Type.kBackOut: 17>, 'kBackInOut': <Type.kBackInOut: 18>, 'kElasticIn': <Type.kElasticIn: 19>, 'kElasticOut': <Type.kElasticOut: 20>, 'kElasticInOut': <Type.kElasticInOut: 21>, 'kQuadish': <Type.kQuadish: 22>, 'kBezier': <Type.kBezier: 23>}
+        kBackIn: animator.skia.Easing.Type  # value = <Type.kBackIn: 16>
+        kBackInOut: animator.skia.Easing.Type  # value = <Type.kBackInOut: 18>
+        kBackOut: animator.skia.Easing.Type  # value = <Type.kBackOut: 17>
+        kBezier: animator.skia.Easing.Type  # value = <Type.kBezier: 23>
+        kBounceIn: animator.skia.Easing.Type  # value = <Type.kBounceIn: 10>
+        kBounceInOut: animator.skia.Easing.Type  # value = <Type.kBounceInOut: 12>
+        kBounceOut: animator.skia.Easing.Type  # value = <Type.kBounceOut: 11>
+        kCircIn: animator.skia.Easing.Type  # value = <Type.kCircIn: 4>
+        kCircInOut: animator.skia.Easing.Type  # value = <Type.kCircInOut: 6>
+        kCircOut: animator.skia.Easing.Type  # value = <Type.kCircOut: 5>
+        kElasticIn: animator.skia.Easing.Type  # value = <Type.kElasticIn: 19>
+        kElasticInOut: animator.skia.Easing.Type  # value = <Type.kElasticInOut: 21>
+        kElasticOut: animator.skia.Easing.Type  # value = <Type.kElasticOut: 20>
+        kExpIn: animator.skia.Easing.Type  # value = <Type.kExpIn: 7>
+        kExpInOut: animator.skia.Easing.Type  # value = <Type.kExpInOut: 9>
+        kExpOut: animator.skia.Easing.Type  # value = <Type.kExpOut: 8>
+        kLinear: animator.skia.Easing.Type  # value = <Type.kLinear: 0>
+        kPowIn: animator.skia.Easing.Type  # value = <Type.kPowIn: 13>
+        kPowInOut: animator.skia.Easing.Type  # value = <Type.kPowInOut: 15>
+        kPowOut: animator.skia.Easing.Type  # value = <Type.kPowOut: 14>
+        kQuadish: animator.skia.Easing.Type  # value = <Type.kQuadish: 22>
+        kSinIn: animator.skia.Easing.Type  # value = <Type.kSinIn: 1>
+        kSinInOut: animator.skia.Easing.Type  # value = <Type.kSinInOut: 3>
+        kSinOut: animator.skia.Easing.Type  # value = <Type.kSinOut: 2>
+        pass
+    @staticmethod
+    def Bezier(x1: float, y1: float, x2: float, y2: float) -> Easing:
+        """
+        Creates a cubic bezier easing from (0, 0) to (1, 1) with control points (*x1*, *y1*) and (*x2*,
+        *y2*), like the CSS ``cubic-bezier()`` timing function. The curve is sampled into a table once,
+        so each evaluation only needs a few Newton iterations.
+        """
+    @typing.overload
+    def __call__(self, t: float | numpy.floating) -> float: ...
+    @typing.overload
+    def __call__(self, t: numpy.ndarray | typing.Sequence[float], out: numpy.ndarray | None = None) -> numpy.ndarray:
+        """
+        Eases *t*. If *t* is a scalar, including a numpy scalar or a 0-d array, returns a float. Otherwise,
+        eases every value of *t*, an array of any shape, and returns the result as a float32 array. The GIL is
+        released while evaluating arrays.
+
+        :param t: The value or values to ease.
+        :param out: A float32 array with the same size as *t* to store the result in. It can be *t* itself.
+        """
+    def __init__(self, type: Easing.Type, a: float = 0, b: float = 0) -> None:
+        """
+        :param type: The curve.
+        :param a: The power for ``kPow*``, the overshoot for ``kBack*``, the amplitude for ``kElastic*`` and the
+            amount for ``kQuadish``. Ignored by other curves.
+        :param b: The period for ``kElastic*``. Ignored by other curves.
+        """
+    def type(self) -> Easing.Type: ...
+    pass
+
 class EncodedImageFormat:
     """
     Members:
@@ -3092,6 +3337,65 @@ class FontStyleSet:
     def matchStyle(self, pattern: FontStyle) -> Typeface: ...
     pass
 
+class FrameRing:
+    """
+    A lock-free single-producer, single-consumer handoff of the slots of a ring of frame buffers, so that one thread
+    can render the next frames while another displays or encodes the current one. The buffers are owned by the
+    caller and indexed by the returned slots; a slot is never handed to both sides at the same time.
+
+    The producer calls :py:meth:`beginWrite`, renders into the returned slot and calls :py:meth:`endWrite`. The
+    consumer calls :py:meth:`acquire`, reads the returned slot and calls :py:meth:`release`. Waiting methods
+    release the GIL, and return ``-1`` once the ring is closed with :py:meth:`close`.
+    """
+
+    def __init__(self, count: int = 2) -> None:
+        """
+        :param count: The number of buffers, at least 1.
+        """
+    def acquire(self, latest: bool = False) -> int:
+        """
+        Waits until a frame is published and returns its slot. Frames are returned in the order they were
+        published. Returns ``-1`` if the ring is closed and no published frame is left. Must only be called by
+        the consumer.
+
+        :param latest: If ``True``, all frames but the newest published one are dropped, which keeps a slow
+            consumer, like a display, from falling behind the producer. Dropped frames are counted by
+            :py:meth:`dropped`.
+        """
+    def beginWrite(self) -> int:
+        """
+        Waits until a slot is free, that is, until fewer than :py:meth:`count` frames are published but not
+        released, and returns it. Returns ``-1`` if the ring is closed. Must only be called by the producer.
+        """
+    def close(self) -> None:
+        """
+        Closes the ring, which wakes up both sides. Frames published before can still be acquired.
+        """
+    def closed(self) -> bool:
+        """
+        Returns whether the ring is closed.
+        """
+    def count(self) -> int:
+        """
+        Returns the number of buffers.
+        """
+    def dropped(self) -> int:
+        """
+        Returns the number of frames dropped by :py:meth:`acquire`.
+        """
+    def endWrite(self) -> None:
+        """
+        Publishes the slot returned by the last :py:meth:`beginWrite`.
+        """
+    def pending(self) -> int:
+        """
+        Returns the number of published frames that are not released yet.
+        """
+    def release(self) -> None:
+        """
+        Returns the slot returned by the last :py:meth:`acquire` to the producer.
+        """
+
 class GradientShader:
     class Flags(IntEnum):
         """
@@ -4564,6 +4868,72 @@ class ImageInfo:
     def width(self) -> int: ...
     pass
 
+class ImageSequenceWriter:
+    """
+    Encodes images and writes them to files on a pool of background threads, so that encoding does not block
+    rendering. :py:meth:`write` blocks while *maxPending* images are waiting to be written, which keeps the memory
+    usage bounded when encoding is slower than rendering. Errors are raised by the next :py:meth:`flush` or
+    :py:meth:`close`.
+
+    Can be used as a context manager, which closes the writer on exit.
+    """
+
+    def __enter__(self) -> ImageSequenceWriter: ...
+    def __exit__(self, arg0: object, arg1: object, arg2: object) -> None: ...
+    def __init__(
+        self,
+        format: EncodedImageFormat = EncodedImageFormat.kPNG,
+        quality: int = 100,
+        workers: int = 0,
+        maxPending: int = 0,
+    ) -> None:
+        """
+        :param format: The format of the images. Should be one of :py:attr:`EncodedImageFormat.kJPEG`,
+            :py:attr:`EncodedImageFormat.kPNG`, :py:attr:`EncodedImageFormat.kWEBP`.
+        :param quality: The quality of the images. 100 is the best quality.
+        :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+        :param maxPending: The maximum number of images waiting to be written. If ``0``, twice the number of
+            workers is used.
+        """
+    def close(self) -> None:
+        """
+        Flushes the writer and stops the worker threads. No more images can be written after this.
+        """
+    def flush(self) -> None:
+        """
+        Waits until all queued images are written. Raises the first error that occurred since the last flush.
+        """
+    def pending(self) -> int:
+        """
+        Returns the number of images that are not written yet.
+        """
+    @typing.overload
+    def write(self, image: Image, path: str) -> None:
+        """
+        Queues *image* to be written to *path*. The image must not be backed by memory that changes later,
+        like an image created with ``Image.fromarray(array, copy=False)``; write the array instead.
+        """
+    @typing.overload
+    def write(
+        self,
+        array: numpy.ndarray,
+        path: str,
+        ct: ColorType = ColorType.kRGBA_8888_ColorType,
+        at: AlphaType = AlphaType.kUnpremul_AlphaType,
+        cs: ColorSpace | None = None,
+    ) -> None:
+        """
+        Copies the pixels of *array* (like :py:attr:`Scene.frame`) and queues them to be written to *path*.
+        The array can be modified as soon as this returns.
+
+        :param array: numpy array of shape=(height, width, channels) and appropriate dtype.
+        :param path: The path of the file.
+        :param ct: The color type of the array.
+        :param at: The alpha type of the array.
+        :param cs: The color space of the array.
+        """
+    pass
+
 class Line2DPathEffect:
     @staticmethod
     def Make(width: float, matrix: Matrix) -> PathEffect: ...
@@ -4695,6 +5065,22 @@ class Matrix:
     @staticmethod
     def MakeRectToRect(src: _Rect, dst: _Rect, stf: Matrix.ScaleToFit) -> Matrix: ...
     @staticmethod
+    def MapPoints(
+        matrices: numpy.ndarray, pts: numpy.ndarray, out: numpy.ndarray | None = None
+    ) -> numpy.ndarray:
+        """
+        Maps the points in ``pts[i]`` by the matrix ``matrices[i]`` for every *i*, in place or into *out* if
+        given, and returns the mapped array. This transforms many point sets, like the vertices of many
+        entities, in a single call without creating any :py:class:`Matrix` or :py:class:`Point`. The GIL is
+        released while mapping.
+
+        :param matrices: numpy array of shape=(K, 3, 3), where each matrix is in the order of
+            :py:meth:`get9`
+        :param pts: float32 numpy array of shape=(K, N, 2) to transform
+        :param out: float32 numpy array of the same shape to store the mapped points in
+        :return: *out* if given, else *pts*
+        """
+    @staticmethod
     def RectToRect(src: _Rect, dst: _Rect, mode: Matrix.ScaleToFit = ScaleToFit.kFill_ScaleToFit) -> Matrix: ...
     @staticmethod
     @typing.overload
@@ -4823,6 +5209,17 @@ class Matrix:
         """
     def mapOrigin(self) -> Point: ...
     def mapPoint(self, pt: _Point) -> Point: ...
+    @typing.overload
+    def mapPoints(self, pts: numpy.ndarray, out: numpy.ndarray | None = None) -> numpy.ndarray:
+        """
+        Maps a float32 numpy array of shape=(N, 2) of points in place, or into *out* if given, and returns the
+        mapped array. No list of :py:class:`Point` is created, and the GIL is released while mapping.
+
+        :param pts: float32 numpy array of shape=(N, 2) to transform
+        :param out: float32 numpy array of the same shape to store the mapped points in
+        :return: *out* if given, else *pts*
+        """
+    @typing.overload
     def mapPoints(self, pts: list[_Point]) -> list[Point]:
         """
         Maps *src* list of :py:class:`Point` and returns a new list of :py:class:`Point`.
@@ -4847,6 +5244,17 @@ class Matrix:
         :return: mapped corner :py:class:`Point`
         """
     def mapVector(self, dx: float, dy: float) -> Point: ...
+    @typing.overload
+    def mapVectors(self, vecs: numpy.ndarray, out: numpy.ndarray | None = None) -> numpy.ndarray:
+        """
+        Maps a float32 numpy array of shape=(N, 2) of vectors in place, or into *out* if given, treating
+        translation as zero, and returns the mapped array. The GIL is released while mapping.
+
+        :param vecs: float32 numpy array of shape=(N, 2) to transform
+        :param out: float32 numpy array of the same shape to store the mapped vectors in
+        :return: *out* if given, else *vecs*
+        """
+    @typing.overload
     def mapVectors(self, vecs: list[_Point]) -> list[Point]:
         """
         Maps *vecs* list of :py:class:`Point` and returns a new list of :py:class:`Point`, multiplying each
@@ -5024,6 +5432,112 @@ class NamedTransferFn:
     kSRGB: animator.skia.cms.TransferFunction
     pass
 
+class Noise:
+    """
+    Seeded, deterministic coherent noise in 1 to 4 dimensions, summed over several octaves (fractional Brownian
+    motion). By default, each octave doubles the frequency and halves the amplitude. Like Processing's ``noise()``,
+    the result is in [0, 1) as long as the falloff is at most 0.5.
+
+    A :py:class:`Noise` can be evaluated at a single point, over an array of points, or over a whole grid into an
+    array with :py:meth:`fill`. Array evaluations release the GIL and are split over multiple threads.
+    """
+
+    class Type:
+        """
+        Members:
+
+          kPerlin
+
+          kSimplex
+
+          kValue
+        """
+
+        def __eq__(self, other: object) -> bool: ...
+        def __getstate__(self) -> int: ...
+        def __hash__(self) -> int: ...
+        def __index__(self) -> int: ...
+        def __init__(self, value: int) -> None: ...
+        def __int__(self) -> int: ...
+        def __ne__(self, other: object) -> bool: ...
+        def __repr__(self) -> str: ...
+        def __setstate__(self, state: int) -> None: ...
+        @property
+        def name(self) -> str:
+            """
+            :type: str
+            """
+        @property
+        def value(self) -> int:
+            """
+            :type: int
+            """
+        __members__: dict  # value = {'kPerlin': <Type.kPerlin: 0>, 'kSimplex': <Type.kSimplex: 1>, 'kValue': <Type.kValue: 2>}
+        kPerlin: animator.skia.Noise.Type  # value = <Type.kPerlin: 0>
+        kSimplex: animator.skia.Noise.Type  # value = <Type.kSimplex: 1>
+        kValue: animator.skia.Noise.Type  # value = <Type.kValue: 2>
+        pass
+    def __init__(
+        self, seed: int = 0, type: Noise.Type = Noise.Type.kPerlin, octaves: int = 4, falloff: float = 0.5,
+        lacunarity: float = 2.0
+    ) -> None:
+        """
+        :param seed: The seed. Noises with the same seed and parameters always return the same values.
+        :param type: The type of noise.
+        :param octaves: The number of octaves, in [1, 32].
+        :param falloff: The factor the amplitude is multiplied by for each octave.
+        :param lacunarity: The factor the frequency is multiplied by for each octave.
+        """
+    @typing.overload
+    def __call__(self, x: float, y: float | None = None, z: float | None = None, w: float | None = None) -> float:
+        """
+        Returns the noise at the point (*x*, *y*, *z*, *w*). Omitted coordinates reduce the dimensions.
+        """
+    @typing.overload
+    def __call__(
+        self, points: numpy.ndarray | typing.Sequence[typing.Sequence[float]], workers: int = 0
+    ) -> numpy.ndarray:
+        """
+        Returns the noise at every point of *points*, an array of shape=(..., D) with D in [1, 4] coordinates
+        per point. The result has the shape of *points* without the last dimension.
+
+        :param points: The points.
+        :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+        """
+    def fill(
+        self, array: numpy.ndarray, x: float = 0, y: float = 0, z: float | None = None, scale: float = 0.01,
+        workers: int = 0
+    ) -> None:
+        """
+        Fills *array* with the noise over a grid, in parallel. The pixel at (row, col) gets the noise at
+        (*x* + col * *scale*, *y* + row * *scale*) or, if *z* is given, at (..., *z*), which can be used to
+        animate the texture. Every channel of a pixel gets the same value, except the alpha channel of a 4
+        channel uint8 array, which is set to ``255``, so the array of a :py:class:`Canvas` can be filled
+        directly. The GIL is released while filling.
+
+        :param array: A C-contiguous float32 or uint8 array of shape=(height, width) or
+            (height, width, channels). Float arrays get values in [0, 1), and uint8 arrays in [0, 255].
+        :param x: The x coordinate of the first column.
+        :param y: The y coordinate of the first row.
+        :param z: The z coordinate of the grid. If ``None``, 2D noise is used.
+        :param scale: The distance between adjacent pixels in noise coordinates.
+        :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+        """
+    @property
+    def falloff(self) -> float: ...
+    @falloff.setter
+    def falloff(self, arg0: float) -> None: ...
+    @property
+    def lacunarity(self) -> float: ...
+    @lacunarity.setter
+    def lacunarity(self, arg0: float) -> None: ...
+    @property
+    def octaves(self) -> int: ...
+    @octaves.setter
+    def octaves(self, arg0: int) -> None: ...
+    @property
+    def type(self) -> Noise.Type: ...
+
 class OpBuilder:
     def __init__(self) -> None: ...
     def add(self, path: Path, op: PathOp) -> None: ...
@@ -5203,6 +5717,16 @@ class Paint:
     def __ne__(self, other: Paint) -> bool: ...
     def __str__(self) -> str: ...
     def asBlendMode(self) -> BlendMode | None: ...
+    def canComputeFastBounds(self) -> bool: ...
+    def computeFastBounds(self, orig: _Rect) -> Rect:
+        """
+        Returns the bounds of what is drawn with this paint for geometry with bounds *orig*, including the
+        stroke, mask filter and image filter. Only valid if :py:meth:`canComputeFastBounds` is ``True``.
+        """
+    def computeFastStrokeBounds(self, orig: _Rect) -> Rect:
+        """
+        Same as :py:meth:`computeFastBounds`, but as if the paint had the stroke style.
+        """
     def getAlpha(self) -> int: ...
     def getAlphaf(self) -> float: ...
     def getBlendMode_or(self, defaultMode: BlendMode) -> BlendMode: ...
@@ -5302,10 +5826,247 @@ class ParsePath:
         Create an SVG string from a :py:class:`skia.Path`.
         """
 
-class Path:
-    class AddPathMode:
+class ParticleSystem:
+    """
+    A fixed capacity pool of particles that are spawned, simulated and drawn without touching Python. The position,
+    velocity, age, life, rotation, spin, scale and color of the particles are stored in separate arrays, and the
+    whole system is drawn with a single :py:meth:`Canvas.drawAtlas` or :py:meth:`Canvas.drawVertices` call.
+
+    Each :py:meth:`step` ages the particles and removes the dead ones, spawns new particles from the
+    :py:attr:`emitter`, applies the :py:attr:`gravity`, :py:attr:`drag` and attractors to the velocities, and moves
+    the particles. The color of each particle is interpolated from the emitter's *startColor* to *endColor* over its
+    life. The GIL is released while stepping and drawing.
+    """
+
+    class Emitter:
+        """
+        Describes how new particles are spawned. Angles are in degrees, speeds in pixels per second and life in
+        seconds. Each value is sampled uniformly between its min and max.
         """
-        Members:
+
+        def __init__(self) -> None: ...
+        @property
+        def endColor(self) -> Color4f:
+            """
+            :type: _Color4f
+            """
+        @endColor.setter
+        def endColor(self, arg0: _Color4f) -> None:
+            pass
+        @property
+        def extent(self) -> Point:
+            """
+            The half width and half height of the rectangle around *position* where particles are spawned.
+
+            :type: _Point
+            """
+        @extent.setter
+        def extent(self, arg0: _Point) -> None:
+            pass
+        @property
+        def maxAngle(self) -> float:
+            """
+            :type: float
+            """
+        @maxAngle.setter
+        def maxAngle(self, arg0: float) -> None:
+            pass
+        @property
+        def maxLife(self) -> float:
+            """
+            :type: float
+            """
+        @maxLife.setter
+        def maxLife(self, arg0: float) -> None:
+            pass
+        @property
+        def maxScale(self) -> float:
+            """
+            :type: float
+            """
+        @maxScale.setter
+        def maxScale(self, arg0: float) -> None:
+            pass
+        @property
+        def maxSpeed(self) -> float:
+            """
+            :type: float
+            """
+        @maxSpeed.setter
+        def maxSpeed(self, arg0: float) -> None:
+            pass
+        @property
+        def maxSpin(self) -> float:
+            """
+            The maximum angular velocity in degrees per second.
+
+            :type: float
+            """
+        @maxSpin.setter
+        def maxSpin(self, arg0: float) -> None:
+            pass
+        @property
+        def minAngle(self) -> float:
+            """
+            :type: float
+            """
+        @minAngle.setter
+        def minAngle(self, arg0: float) -> None:
+            pass
+        @property
+        def minLife(self) -> float:
+            """
+            :type: float
+            """
+        @minLife.setter
+        def minLife(self, arg0: float) -> None:
+            pass
+        @property
+        def minScale(self) -> float:
+            """
+            :type: float
+            """
+        @minScale.setter
+        def minScale(self, arg0: float) -> None:
+            pass
+        @property
+        def minSpeed(self) -> float:
+            """
+            :type: float
+            """
+        @minSpeed.setter
+        def minSpeed(self, arg0: float) -> None:
+            pass
+        @property
+        def minSpin(self) -> float:
+            """
+            The minimum angular velocity in degrees per second.
+
+            :type: float
+            """
+        @minSpin.setter
+        def minSpin(self, arg0: float) -> None:
+            pass
+        @property
+        def position(self) -> Point:
+            """
+            The center of the area where particles are spawned.
+
+            :type: _Point
+            """
+        @position.setter
+        def position(self, arg0: _Point) -> None:
+            pass
+        @property
+        def rate(self) -> float:
+            """
+            The number of particles spawned per second.
+
+            :type: float
+            """
+        @rate.setter
+        def rate(self, arg0: float) -> None:
+            pass
+        @property
+        def startColor(self) -> Color4f:
+            """
+            :type: _Color4f
+            """
+        @startColor.setter
+        def startColor(self, arg0: _Color4f) -> None:
+            pass
+        pass
+    def __init__(self, capacity: int, seed: int = 0) -> None:
+        """
+        :param capacity: The maximum number of live particles.
+        :param seed: The seed of the random number generator used to spawn particles.
+        """
+    def addAttractor(self, position: _Point, strength: float) -> None:
+        """
+        Adds a point that accelerates particles towards it by ``strength / distance``. A negative *strength*
+        repels the particles.
+        """
+    def bounds(self, sprite: Image | None = None, size: float = 1) -> Rect:
+        """
+        Returns the bounds of the particles as drawn by :py:meth:`draw`.
+        """
+    def capacity(self) -> int: ...
+    def clear(self) -> None:
+        """
+        Removes all particles.
+        """
+    def clearAttractors(self) -> None: ...
+    def count(self) -> int:
+        """
+        Returns the number of live particles.
+        """
+    def draw(
+        self,
+        canvas: Canvas,
+        paint: Paint,
+        sprite: Image | None = None,
+        size: float = 1,
+        sampling: SamplingOptions = ...,
+    ) -> None:
+        """
+        Draws all particles on *canvas* with *paint*.
+
+        If *sprite* is given, each particle is drawn as *sprite* centered on its position, scaled by its scale,
+        rotated by its rotation, and modulated by its color. Otherwise, each particle is drawn as a square with
+        side ``size * scale`` filled with its color.
+
+        :param canvas: The canvas to draw on.
+        :param paint: The paint to draw with.
+        :param sprite: The image to draw for each particle.
+        :param size: The side of the squares drawn when *sprite* is ``None``.
+        :param sampling: The sampling options for *sprite*.
+        """
+    def emit(self, n: int) -> None:
+        """
+        Spawns up to *n* particles at once from the :py:attr:`emitter`.
+        """
+    def positions(self) -> numpy.ndarray:
+        """
+        Returns a copy of the positions of the live particles as a float32 numpy array of shape=(N, 2).
+        """
+    def step(self, dt: float) -> None:
+        """
+        Advances the simulation by *dt* seconds.
+        """
+    @property
+    def drag(self) -> float:
+        """
+        The fraction of the velocity lost per second is ``1 - exp(-drag)``.
+
+        :type: float
+        """
+    @drag.setter
+    def drag(self, arg0: float) -> None:
+        pass
+    @property
+    def emitter(self) -> ParticleSystem.Emitter:
+        """
+        :type: ParticleSystem.Emitter
+        """
+    @emitter.setter
+    def emitter(self, arg0: ParticleSystem.Emitter) -> None:
+        pass
+    @property
+    def gravity(self) -> Point:
+        """
+        The acceleration applied to every particle.
+
+        :type: _Point
+        """
+    @gravity.setter
+    def gravity(self, arg0: _Point) -> None:
+        pass
+    pass
+
+class Path:
+    class AddPathMode:
+        """
+        Members:
 
           kAppend_AddPathMode
 
@@ -5512,6 +6273,15 @@ class Path:
     @typing.overload
     def Oval(r: _Rect, dir: PathDirection, startIndex: int) -> Path: ...
     @staticmethod
+    @typing.overload
+    def Polygon(
+        points: numpy.ndarray, isClosed: bool, ft: PathFillType = PathFillType.kWinding, isVolatile: bool = False
+    ) -> Path:
+        """
+        Create a polygonal path from a float32 array of shape (N, 2).
+        """
+    @staticmethod
+    @typing.overload
     def Polygon(
         points: list[_Point], isClosed: bool, ft: PathFillType = PathFillType.kWinding, isVolatile: bool = False
     ) -> Path:
@@ -5639,6 +6409,24 @@ class Path:
         """
         Returns the filled equivalent of the stroked path.
         """
+    @staticmethod
+    def fromarrays(
+        verbs: numpy.ndarray,
+        points: numpy.ndarray,
+        weights: numpy.ndarray | None = None,
+        ft: PathFillType = PathFillType.kWinding,
+        isVolatile: bool = False,
+    ) -> Path:
+        """
+        Creates a :py:class:`Path` from the arrays returned by :py:meth:`toarrays`. The arrays are converted to
+        the right type if needed, and their data is copied into the path at once.
+
+        :param verbs: uint8 array of :py:class:`PathVerb` values.
+        :param points: float32 array of shape (N, 2).
+        :param weights: float32 array with the weight of each conic verb, or ``None`` if there are no conics.
+        :param ft: The fill type of the path.
+        :param isVolatile: Whether the path is volatile.
+        """
     def getBounds(self) -> Rect: ...
     def getFillType(self) -> PathFillType: ...
     def getGenerationID(self) -> int: ...
@@ -5769,6 +6557,12 @@ class Path:
         """
         Return the resulting rectangle to the tight bounds of the path.
         """
+    def toarrays(self) -> tuple[numpy.ndarray, numpy.ndarray, numpy.ndarray]:
+        """
+        Returns the geometry of the :py:class:`Path` as a tuple of three numpy arrays: the verbs as uint8
+        :py:class:`PathVerb` values, the points as float32 array of shape (N, 2), and the weights of the conic
+        verbs as float32 array. Use :py:meth:`fromarrays` to create a path from them.
+        """
     def toggleInverseFillType(self) -> None: ...
     def transform(self, matrix: Matrix, pc: ApplyPerspectiveClip = ApplyPerspectiveClip.kYes) -> None: ...
     def updateBoundsCache(self) -> None: ...
@@ -6183,9 +6977,73 @@ class PathMeasure:
         """
         Given a start and stop distance, return the intervening segment(s).
         """
+    def getTotalLength(self) -> float:
+        """
+        Returns the length of all contours, unlike :py:meth:`getLength` which only measures the current one.
+        """
     def isClosed(self) -> bool: ...
     def nextContour(self) -> bool: ...
-    def setPath(self, path: Path, forceClosed: bool = False) -> None: ...
+    @typing.overload
+    def sample(
+        self, count: int, endpoint: bool = True, rsxform: bool = False
+    ) -> tuple[numpy.ndarray, numpy.ndarray] | numpy.ndarray:
+        """
+        Samples *count* positions and tangents evenly spaced along all contours of the path. Returns the same
+        as the overload taking *distances*.
+
+        :param count: The number of samples.
+        :param endpoint: Whether the last sample is at the end of the path. If ``False``, the samples are spaced
+            by ``getTotalLength() / count``, which suits closed paths.
+        :param rsxform: Whether to return RSXforms instead of positions and tangents.
+        """
+    @typing.overload
+    def sample(
+        self, distances: numpy.ndarray | typing.Sequence[float], rsxform: bool = False
+    ) -> tuple[numpy.ndarray, numpy.ndarray] | numpy.ndarray:
+        """
+        Samples the positions and tangents at all *distances* in a single call. Unlike :py:meth:`getPosTan`,
+        distances are measured along all contours of the path, one after another, and are pinned to
+        0 <= distance <= :py:meth:`getTotalLength`. The GIL is released while sampling.
+
+        If *rsxform* is ``True``, returns a float32 array of shape=(N, 4) of :py:class:`RSXform` that rotate to
+        the tangent and translate to the position, which can be passed directly to the array overloads of
+        :py:meth:`Canvas.drawAtlas`, :py:meth:`Canvas.drawGlyphs` and :py:meth:`TextBlob.MakeFromRSXform`.
+
+        :param distances: 1D array of distances.
+        :param rsxform: Whether to return RSXforms instead of positions and tangents.
+        :return: tuple of (positions, tangents), each a float32 array of shape=(N, 2), or an array of
+            RSXforms.
+        """
+    def setPath(self, path: Path | None, forceClosed: bool = False) -> None: ...
+    pass
+
+class PathMorph:
+    """
+    Interpolates between any two paths, unlike :py:meth:`Path.interpolate` which needs paths with the same verbs
+    and number of points.
+
+    The paths are prepared once when the :py:class:`PathMorph` is created. All segments are converted to cubics,
+    contours are paired from the largest to the smallest (a missing contour grows from a point), paired contours
+    are split to the same number of cubics, and closed contours are turned to the same direction with their start
+    points aligned. After that, each :py:meth:`interpolate` is a single linear interpolation of the points, so the
+    same morph should be reused for every frame of an animation.
+    """
+
+    def __init__(self, start: Path, end: Path) -> None: ...
+    def countContours(self) -> int: ...
+    def countPoints(self) -> int: ...
+    @typing.overload
+    def interpolate(self, t: float) -> Path:
+        """
+        Returns the path at *t*, which is *start* at ``0`` and *end* at ``1``. *t* outside of [0, 1]
+        extrapolates. The fill type and whether each contour is closed are taken from *start* if *t* < 0.5,
+        else from *end*.
+        """
+    @typing.overload
+    def interpolate(self, t: float, dst: Path) -> None:
+        """
+        Same as above, but replaces the content of *dst* with the path at *t*, reusing its memory.
+        """
     pass
 
 class PathOp:
@@ -6363,6 +7221,55 @@ class Picture:
     def uniqueID(self) -> int: ...
     pass
 
+class PictureRecorder:
+    def __init__(self) -> None: ...
+    @typing.overload
+    def beginRecording(self, bounds: _Rect, bbhFactory: BBHFactory | None = None) -> Canvas:
+        """
+        Returns the canvas that records the drawing commands.
+
+        :param bounds: the cull rect used when recording this picture. Any drawing the falls outside of this
+            rect is undefined, and may be drawn or it may not.
+        :param bbhFactory: factory to create a bounding box hierarchy for the picture, like
+            :py:class:`RTreeFactory`. With a BBH, only the drawing commands that intersect the clip are
+            replayed when the picture is drawn.
+        :return: the canvas.
+        """
+    @typing.overload
+    def beginRecording(self, width: float, height: float, bbhFactory: BBHFactory | None = None) -> Canvas: ...
+    def finishRecordingAsDrawable(self) -> Drawable:
+        """
+        Signal that the caller is done recording. This invalidates the canvas returned by
+        :py:meth:`beginRecording` or :py:meth:`getRecordingCanvas`.
+
+        Unlike :py:meth:`finishRecordingAsPicture`, which returns an immutable picture, the returned drawable
+        may contain live references to other drawables (if they were added to the recording canvas) and
+        therefore this drawable will reflect the current state of those nested drawables anytime it is drawn or
+        a new picture is snapped from it (by calling :py:meth:`Drawable.makePictureSnapshot`).
+        """
+    def finishRecordingAsPicture(self) -> Picture:
+        """
+        Signal that the caller is done recording. This invalidates the canvas returned by
+        :py:meth:`beginRecording` or :py:meth:`getRecordingCanvas`.
+
+        The returned picture is immutable.
+        """
+    def finishRecordingAsPictureWithCull(self, cullRect: _Rect) -> Picture:
+        """
+        Signal that the caller is done recording, and update the cull rect to use for bounding box hierarchy
+        (BBH) generation. The behavior is the same as calling :py:meth:`finishRecordingAsPicture`, except that
+        this method updates the cull rect initially passed into :py:meth:`beginRecording`.
+
+        :param cullRect: the new culling rectangle to use as the overall bound for BBH generation and
+            subsequent culling operations.
+        :return: the picture containing the recorded content.
+        """
+    def getRecordingCanvas(self) -> Canvas | None:
+        """
+        Returns the recording canvas if one is active, or ``None`` if recording is not active.
+        """
+    pass
+
 class PixelGeometry:
     """
     Members:
@@ -6904,6 +7811,14 @@ class RSXform:
         pass
     pass
 
+class RTreeFactory(BBHFactory):
+    """
+    Creates an R-tree :py:class:`BBHFactory`.
+    """
+
+    def __init__(self) -> None: ...
+    pass
+
 class Rect:
     @staticmethod
     def Intersects(a: _Rect, b: _Rect) -> bool: ...
@@ -8292,6 +9207,16 @@ class TextBlob:
         Returns a :py:class:`TextBlob` built from a single run of *text* with *xpos* and a single *constY* value.
         """
     @staticmethod
+    @typing.overload
+    def MakeFromRSXform(
+        text: str, xform: numpy.ndarray, font: Font, encoding: TextEncoding = TextEncoding.kUTF8
+    ) -> TextBlob:
+        """
+        Returns a :py:class:`TextBlob` built from a single run of *text* with *xform*, a float32 array of shape
+        (N, 4) with one :py:class:`RSXform` per glyph, like the one returned by :py:meth:`PathMeasure.sample`.
+        """
+    @staticmethod
+    @typing.overload
     def MakeFromRSXform(
         text: str, xform: list[RSXform], font: Font, encoding: TextEncoding = TextEncoding.kUTF8
     ) -> TextBlob: ...
@@ -8515,6 +9440,133 @@ class TextUtils_Align:
     kLeft_Align: animator.skia.TextUtils_Align  # value = <TextUtils_Align.kLeft_Align: 0>
     kRight_Align: animator.skia.TextUtils_Align  # value = <TextUtils_Align.kRight_Align: 2>
 
+class Timeline:
+    """
+    A set of tracks of keyframes, which are all evaluated at once in native code. A track animates a scalar, a
+    :py:class:`Point`, a :py:class:`Color4f`, a :py:class:`Matrix` or a :py:class:`Path`. Each keyframe has an
+    :py:class:`Easing` for the segment that ends at it. Colors can be interpolated in sRGB, linear sRGB or OKLab,
+    and paths are interpolated with a :py:class:`PathMorph` for each pair of consecutive keyframes. Before the
+    first and after the last keyframe of a track, its value is held.
+
+    :py:meth:`evaluate` doesn't modify the timeline, so the values only depend on the time, and frames can be
+    evaluated in any order, from any thread.
+    """
+
+    class ColorSpace:
+        """
+        Members:
+
+          kSRGB
+
+          kLinearSRGB
+
+          kOKLab
+        """
+
+        def __eq__(self, other: object) -> bool: ...
+        def __getstate__(self) -> int: ...
+        def __hash__(self) -> int: ...
+        def __index__(self) -> int: ...
+        def __init__(self, value: int) -> None: ...
+        def __int__(self) -> int: ...
+        def __ne__(self, other: object) -> bool: ...
+        def __repr__(self) -> str: ...
+        def __setstate__(self, state: int) -> None: ...
+        @property
+        def name(self) -> str:
+            """
+            :type: str
+            """
+        @property
+        def value(self) -> int:
+            """
+            :type: int
+            """
+        __members__: dict  # value = {'kSRGB': <ColorSpace.kSRGB: 0>, 'kLinearSRGB': <ColorSpace.kLinearSRGB: 1>, 'kOKLab': <ColorSpace.kOKLab: 2>}
+        kLinearSRGB: animator.skia.Timeline.ColorSpace  # value = <ColorSpace.kLinearSRGB: 1>
+        kOKLab: animator.skia.Timeline.ColorSpace  # value = <ColorSpace.kOKLab: 2>
+        kSRGB: animator.skia.Timeline.ColorSpace  # value = <ColorSpace.kSRGB: 0>
+        pass
+    class TrackType:
+        """
+        Members:
+
+          kScalar
+
+          kPoint
+
+          kColor
+
+          kMatrix
+
+          kPath
+        """
+
+        def __eq__(self, other: object) -> bool: ...
+        def __getstate__(self) -> int: ...
+        def __hash__(self) -> int: ...
+        def __index__(self) -> int: ...
+        def __init__(self, value: int) -> None: ...
+        def __int__(self) -> int: ...
+        def __ne__(self, other: object) -> bool: ...
+        def __repr__(self) -> str: ...
+        def __setstate__(self, state: int) -> None: ...
+        @property
+        def name(self) -> str:
+            """
+            :type: str
+            """
+        @property
+        def value(self) -> int:
+            """
+            :type: int
+            """
+        __members__: dict  # value = {'kScalar': <TrackType.kScalar: 0>, 'kPoint': <TrackType.kPoint: 1>, 'kColor': <TrackType.kColor: 2>, 'kMatrix': <TrackType.kMatrix: 3>, 'kPath': <TrackType.kPath: 4>}
+        kColor: animator.skia.Timeline.TrackType  # value = <TrackType.kColor: 2>
+        kMatrix: animator.skia.Timeline.TrackType  # value = <TrackType.kMatrix: 3>
+        kPath: animator.skia.Timeline.TrackType  # value = <TrackType.kPath: 4>
+        kPoint: animator.skia.Timeline.TrackType  # value = <TrackType.kPoint: 1>
+        kScalar: animator.skia.Timeline.TrackType  # value = <TrackType.kScalar: 0>
+        pass
+    def __init__(self) -> None: ...
+    def addKeyframe(
+        self,
+        track: int,
+        time: float,
+        value: float | Point | Color4f | Matrix | Path | tuple | int,
+        easing: Easing | None = None,
+    ) -> None:
+        """
+        Adds a keyframe to *track*. Keyframes can be added in any order. Keyframes at the same time are kept in
+        the order they were added, so the value jumps at that time.
+
+        :param track: The index of the track.
+        :param time: The time of the keyframe.
+        :param value: The value at *time*, a float, :py:class:`Point`, :py:class:`Color4f`, :py:class:`Matrix`
+            or :py:class:`Path` depending on the type of the track.
+        :param easing: The easing of the segment from the previous keyframe to this one. Linear if ``None``.
+        """
+    def addTrack(self, type: Timeline.TrackType, space: Timeline.ColorSpace = Timeline.ColorSpace.kSRGB) -> int:
+        """
+        Adds an empty track and returns its index.
+
+        :param type: The type of the values of the track.
+        :param space: The color space colors are interpolated in. Ignored by other tracks.
+        """
+    def countKeyframes(self, track: int) -> int: ...
+    def countTracks(self) -> int: ...
+    def duration(self) -> float:
+        """
+        Returns the time of the last keyframe of all tracks.
+        """
+    def evaluate(self, time: float) -> list[float | Point | Color4f | Matrix | Path | None]:
+        """
+        Evaluates every track at *time* and returns the values as a list, in the order of the tracks. The value
+        of a track without keyframes is ``None``. The GIL is released while evaluating.
+        """
+    def trackType(self, track: int) -> Timeline.TrackType: ...
+    pass
+
 class TileMode:
     """
     Members:
@@ -8780,6 +9832,20 @@ class Vertices:
         kTriangles_VertexMode: animator.skia.Vertices.VertexMode  # value = <VertexMode.kTriangles_VertexMode: 0>
         pass
     @staticmethod
+    @typing.overload
+    def MakeCopy(
+        mode: Vertices.VertexMode,
+        positions: numpy.ndarray,
+        texs: numpy.ndarray | None,
+        colors: numpy.ndarray | None,
+        indices: numpy.ndarray | None = None,
+        offset: _Point = (0, 0),
+    ) -> Vertices:
+        """
+        Create a vertices by copying numpy arrays. See :py:meth:`__init__` for the array shapes.
+        """
+    @staticmethod
+    @typing.overload
     def MakeCopy(
         mode: Vertices.VertexMode,
         positions: list[_Point],
@@ -8790,6 +9856,28 @@ class Vertices:
         """
         Create a vertices by copying the specified arrays.
         """
+    @typing.overload
+    def __init__(
+        self,
+        mode: Vertices.VertexMode,
+        positions: numpy.ndarray,
+        texs: numpy.ndarray | None = None,
+        colors: numpy.ndarray | None = None,
+        indices: numpy.ndarray | None = None,
+        offset: _Point = (0, 0),
+    ) -> None:
+        """
+        Create a vertices by copying numpy arrays, without creating any :py:class:`Point` or
+        :py:class:`Color4f`. The GIL is released while copying.
+
+        :param mode: The vertex mode.
+        :param positions: float32 numpy array of shape=(N, 2).
+        :param texs: float32 numpy array of shape=(N, 2), or ``None``.
+        :param colors: uint32 numpy array of shape=(N,) of ARGB colors, or ``None``.
+        :param indices: uint16 numpy array of shape=(M,), or ``None``.
+        :param offset: Added to every position while copying.
+        """
+    @typing.overload
     def __init__(
         self,
         mode: Vertices.VertexMode,
@@ -8965,6 +10053,56 @@ def RGBToHSV(red: int, green: int, blue: int) -> list[float]:
         value from 0 to 1.
     """
 
+def renderPictureTiled(
+    picture: Picture,
+    array: numpy.ndarray,
+    tileWidth: int = 256,
+    tileHeight: int = 256,
+    workers: int = 0,
+    ct: ColorType = ColorType.kRGBA_8888_ColorType,
+    at: AlphaType = AlphaType.kUnpremul_AlphaType,
+    cs: ColorSpace | None = None,
+) -> None:
+    """
+    Replays *picture* into *array* in parallel. The array is split into tiles, and each tile is drawn by a
+    worker thread through its own canvas over that part of the array, so the pixels are the same as when
+    playing back the picture on ``Canvas(array)``. The GIL is released while drawing. Recording the picture
+    with :py:class:`RTreeFactory` lets each tile skip the drawing commands outside of it.
+
+    :param picture: The picture to draw.
+    :param array: numpy array of shape=(height, width, channels) and appropriate dtype to draw into.
+    :param tileWidth: The width of each tile, rounded up to a multiple of 8.
+    :param tileHeight: The height of each tile, rounded up to a multiple of 8.
+    :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+    :param ct: The color type of the array.
+    :param at: The alpha type of the array.
+    :param cs: The color space of the array.
+    """
+
+def renderPictures(
+    pictures: list[Picture],
+    width: int,
+    height: int,
+    workers: int = 0,
+    ct: ColorType = ColorType.kRGBA_8888_ColorType,
+    at: AlphaType = AlphaType.kUnpremul_AlphaType,
+    cs: ColorSpace | None = None,
+) -> list[numpy.ndarray]:
+    """
+    Rasterizes *pictures* in parallel and returns the frames as a list of numpy arrays, in the same order as
+    *pictures*. Each worker thread owns its own raster :py:class:`Surface`, which is cleared to transparent
+    before drawing each picture. The GIL is released while rasterizing.
+
+    :param pictures: The pictures to rasterize.
+    :param width: The width of each frame.
+    :param height: The height of each frame.
+    :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+    :param ct: The color type of the frames.
+    :param at: The alpha type of the frames.
+    :param cs: The color space of the frames.
+    :return: A list of numpy arrays of shape=(height, width, channels).
+    """
+
 def uniqueColor(l: float = 71, s: float = 100) -> Color4f:
     """
     Returns a unique color every time it is called. Uses HSLuv (https://www.hsluv.org/) internally.
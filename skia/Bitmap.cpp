@@ -139,11 +139,13 @@ void initBitmap(py::module &m)
         .def("readyToDraw", &SkBitmap::readyToDraw)
         .def("getGenerationID", &SkBitmap::getGenerationID)
         .def("notifyPixelsChanged", &SkBitmap::notifyPixelsChanged)
-        .def("eraseColor", py::overload_cast<SkColor4f>(&SkBitmap::eraseColor, py::const_), "c"_a)
-        .def("eraseColor", py::overload_cast<SkColor>(&SkBitmap::eraseColor, py::const_), "c"_a)
-        .def("eraseARGB", &SkBitmap::eraseARGB, "a"_a, "r"_a, "g"_a, "b"_a)
-        .def("erase", py::overload_cast<SkColor4f, const SkIRect &>(&SkBitmap::erase, py::const_), "c"_a, "area"_a)
-        .def("erase", py::overload_cast<SkColor, const SkIRect &>(&SkBitmap::erase, py::const_), "c"_a, "area"_a)
+        .def("eraseColor", py::overload_cast<SkColor4f>(&SkBitmap::eraseColor, py::const_), "c"_a, ReleaseGIL())
+        .def("eraseColor", py::overload_cast<SkColor>(&SkBitmap::eraseColor, py::const_), "c"_a, ReleaseGIL())
+        .def("eraseARGB", &SkBitmap::eraseARGB, "a"_a, "r"_a, "g"_a, "b"_a, ReleaseGIL())
+        .def("erase", py::overload_cast<SkColor4f, const SkIRect &>(&SkBitmap::erase, py::const_), "c"_a, "area"_a,
+             ReleaseGIL())
+        .def("erase", py::overload_cast<SkColor, const SkIRect &>(&SkBitmap::erase, py::const_), "c"_a, "area"_a,
+             ReleaseGIL())
         .def("getColor", &SkBitmap::getColor, "x"_a, "y"_a)
         .def("getColor4f", &SkBitmap::getColor4f, "x"_a, "y"_a)
         .def("getAlphaf", &SkBitmap::getAlphaf, "x"_a, "y"_a)
@@ -161,9 +163,9 @@ void initBitmap(py::module &m)
              "Copies *dstInfo* pixels starting from (*srcX*, *srcY*) to *dstPixels* buffer.", "dstInfo"_a,
              "dstPixels"_a, "dstRowBytes"_a = 0, "srcX"_a = 0, "srcY"_a = 0)
         .def("readPixels", py::overload_cast<const SkPixmap &, int, int>(&SkBitmap::readPixels, py::const_), "dst"_a,
-             "srcX"_a = 0, "srcY"_a = 0)
+             "srcX"_a = 0, "srcY"_a = 0, ReleaseGIL())
         .def("writePixels", py::overload_cast<const SkPixmap &, int, int>(&SkBitmap::writePixels), "src"_a,
-             "dstX"_a = 0, "dstY"_a = 0)
+             "dstX"_a = 0, "dstY"_a = 0, ReleaseGIL())
         .def(
             "extractAlpha",
             [](const SkBitmap &self, const SkPaint *paint)
@@ -175,7 +177,7 @@ void initBitmap(py::module &m)
                 throw std::runtime_error("Failed to extract alpha");
             },
             "Returns a tuple of (bitmap describing the alpha values, top-left position of the alpha values).",
-            "paint"_a = nullptr)
+            "paint"_a = nullptr, ReleaseGIL())
         .def(
             "peekPixels",
             [](const SkBitmap &self)
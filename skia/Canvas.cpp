@@ -2,6 +2,7 @@
 #include "include/core/SkBitmap.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColorSpace.h"
+#include "include/core/SkDrawable.h"
 #include "include/core/SkFont.h"
 #include "include/core/SkPath.h"
 #include "include/core/SkPicture.h"
@@ -166,21 +167,23 @@ void initCanvas(py::module &m)
              "Copies *dstInfo* pixels starting from (*srcX*, *srcY*) to *dstPixels* buffer.", "dstInfo"_a,
              "dstPixels"_a, "dstRowBytes"_a = 0, "srcX"_a = 0, "srcY"_a = 0)
         .def("readPixels", py::overload_cast<const SkPixmap &, int, int>(&SkCanvas::readPixels), "pixmap"_a,
-             "srcX"_a = 0, "srcY"_a = 0)
+             "srcX"_a = 0, "srcY"_a = 0, ReleaseGIL())
         .def("readPixels", py::overload_cast<const SkBitmap &, int, int>(&SkCanvas::readPixels), "bitmap"_a,
-             "srcX"_a = 0, "srcY"_a = 0)
+             "srcX"_a = 0, "srcY"_a = 0, ReleaseGIL())
         .def(
             "writePixels",
             [](SkCanvas &canvas, const SkImageInfo &info, const py::buffer &pixels, const size_t &rowBytes,
                const int &x, const int &y)
             {
                 const py::buffer_info bufInfo = pixels.request();
-                return canvas.writePixels(info, bufInfo.ptr, validateImageInfo_Buffer(info, bufInfo, rowBytes), x, y);
+                const size_t validRowBytes = validateImageInfo_Buffer(info, bufInfo, rowBytes);
+                py::gil_scoped_release release;
+                return canvas.writePixels(info, bufInfo.ptr, validRowBytes, x, y);
             },
             "Writes *pixels* from a buffer to the canvas.", "info"_a, "pixels"_a, "rowBytes"_a = 0, "x"_a = 0,
             "y"_a = 0)
         .def("writePixels", py::overload_cast<const SkBitmap &, int, int>(&SkCanvas::writePixels), "bitmap"_a,
-             "x"_a = 0, "y"_a = 0)
+             "x"_a = 0, "y"_a = 0, ReleaseGIL())
         .def("save", &SkCanvas::save)
         .def("saveLayer", py::overload_cast<const SkRect *, const SkPaint *>(&SkCanvas::saveLayer),
              "bounds"_a = nullptr, "paint"_a = nullptr)
@@ -204,9 +207,9 @@ void initCanvas(py::module &m)
         .def_readwrite("fBackdrop", &SkCanvas::SaveLayerRec::fBackdrop)
         .def_readwrite("fSaveLayerFlags", &SkCanvas::SaveLayerRec::fSaveLayerFlags);
     Canvas.def("saveLayer", py::overload_cast<const SkCanvas::SaveLayerRec &>(&SkCanvas::saveLayer), "layerRec"_a)
-        .def("restore", &SkCanvas::restore)
+        .def("restore", &SkCanvas::restore, ReleaseGIL())
         .def("getSaveCount", &SkCanvas::getSaveCount)
-        .def("restoreToCount", &SkCanvas::restoreToCount, "saveCount"_a)
+        .def("restoreToCount", &SkCanvas::restoreToCount, "saveCount"_a, ReleaseGIL())
         .def("translate", &SkCanvas::translate, "dx"_a, "dy"_a)
         .def("scale", &SkCanvas::scale, "sx"_a, "sy"_a)
         .def("rotate", py::overload_cast<SkScalar>(&SkCanvas::rotate), "degrees"_a)
@@ -230,47 +233,63 @@ void initCanvas(py::module &m)
         .def("getLocalClipBounds", py::overload_cast<>(&SkCanvas::getLocalClipBounds, py::const_))
         .def("getDeviceClipBounds", py::overload_cast<>(&SkCanvas::getDeviceClipBounds, py::const_))
         .def("drawColor", py::overload_cast<SkColor, SkBlendMode>(&SkCanvas::drawColor), "color"_a,
-             "mode"_a = SkBlendMode::kSrcOver)
+             "mode"_a = SkBlendMode::kSrcOver, ReleaseGIL())
         .def("drawColor", py::overload_cast<const SkColor4f &, SkBlendMode>(&SkCanvas::drawColor), "color"_a,
-             "mode"_a = SkBlendMode::kSrcOver)
-        .def("clear", py::overload_cast<SkColor>(&SkCanvas::clear), "color"_a)
-        .def("clear", py::overload_cast<const SkColor4f &>(&SkCanvas::clear), "color"_a)
+             "mode"_a = SkBlendMode::kSrcOver, ReleaseGIL())
+        .def("clear", py::overload_cast<SkColor>(&SkCanvas::clear), "color"_a, ReleaseGIL())
+        .def("clear", py::overload_cast<const SkColor4f &>(&SkCanvas::clear), "color"_a, ReleaseGIL())
         .def("discard", &SkCanvas::discard)
-        .def("drawPaint", &SkCanvas::drawPaint, "paint"_a);
+        .def("drawPaint", &SkCanvas::drawPaint, "paint"_a, ReleaseGIL());
 
     py::enum_<SkCanvas::PointMode>(Canvas, "PointMode")
         .value("kPoints_PointMode", SkCanvas::PointMode::kPoints_PointMode)
         .value("kLines_PointMode", SkCanvas::PointMode::kLines_PointMode)
         .value("kPolygon_PointMode", SkCanvas::PointMode::kPolygon_PointMode);
     Canvas
+        .def(
+            "drawPoints",
+            [](SkCanvas &self, const SkCanvas::PointMode &mode, const FloatArray &pts, const SkPaint &paint)
+            {
+                const size_t count = ndarrayRows(pts, 2, "pts");
+                py::gil_scoped_release release;
+                self.drawPoints(mode, count, reinterpret_cast<const SkPoint *>(pts.data()), paint);
+            },
+            R"doc(
+                Draw the points in *pts*, a float32 array of shape (N, 2), with the specified *mode* and *paint*. The
+                array is used without copying.
+            )doc",
+            "mode"_a, "pts"_a.noconvert(), "paint"_a)
         .def(
             "drawPoints",
             [](SkCanvas &self, const SkCanvas::PointMode &mode, const std::vector<SkPoint> &pts, const SkPaint &paint)
             { self.drawPoints(mode, pts.size(), pts.data(), paint); },
-            "Draw a list of points, *pts*, with the specified *mode* and *paint*.", "mode"_a, "pts"_a, "paint"_a)
+            "Draw a list of points, *pts*, with the specified *mode* and *paint*.", "mode"_a, "pts"_a, "paint"_a,
+            ReleaseGIL())
         .def("drawPoint", py::overload_cast<SkScalar, SkScalar, const SkPaint &>(&SkCanvas::drawPoint), "x"_a, "y"_a,
-             "paint"_a)
-        .def("drawPoint", py::overload_cast<SkPoint, const SkPaint &>(&SkCanvas::drawPoint), "p"_a, "paint"_a)
+             "paint"_a, ReleaseGIL())
+        .def("drawPoint", py::overload_cast<SkPoint, const SkPaint &>(&SkCanvas::drawPoint), "p"_a, "paint"_a,
+             ReleaseGIL())
         .def("drawLine",
              py::overload_cast<SkScalar, SkScalar, SkScalar, SkScalar, const SkPaint &>(&SkCanvas::drawLine), "x0"_a,
-             "y0"_a, "x1"_a, "y1"_a, "paint"_a)
+             "y0"_a, "x1"_a, "y1"_a, "paint"_a, ReleaseGIL())
         .def("drawLine", py::overload_cast<SkPoint, SkPoint, const SkPaint &>(&SkCanvas::drawLine), "p0"_a, "p1"_a,
-             "paint"_a)
-        .def("drawRect", &SkCanvas::drawRect, "rect"_a, "paint"_a)
-        .def("drawIRect", &SkCanvas::drawIRect, "rect"_a, "paint"_a)
-        .def("drawRegion", &SkCanvas::drawRegion, "region"_a, "paint"_a)
-        .def("drawOval", &SkCanvas::drawOval, "oval"_a, "paint"_a)
-        .def("drawRRect", &SkCanvas::drawRRect, "rrect"_a, "paint"_a)
-        .def("drawDRRect", &SkCanvas::drawDRRect, "outer"_a, "inner"_a, "paint"_a)
+             "paint"_a, ReleaseGIL())
+        .def("drawRect", &SkCanvas::drawRect, "rect"_a, "paint"_a, ReleaseGIL())
+        .def("drawIRect", &SkCanvas::drawIRect, "rect"_a, "paint"_a, ReleaseGIL())
+        .def("drawRegion", &SkCanvas::drawRegion, "region"_a, "paint"_a, ReleaseGIL())
+        .def("drawOval", &SkCanvas::drawOval, "oval"_a, "paint"_a, ReleaseGIL())
+        .def("drawRRect", &SkCanvas::drawRRect, "rrect"_a, "paint"_a, ReleaseGIL())
+        .def("drawDRRect", &SkCanvas::drawDRRect, "outer"_a, "inner"_a, "paint"_a, ReleaseGIL())
         .def("drawCircle", py::overload_cast<SkScalar, SkScalar, SkScalar, const SkPaint &>(&SkCanvas::drawCircle),
-             "cx"_a, "cy"_a, "radius"_a, "paint"_a)
+             "cx"_a, "cy"_a, "radius"_a, "paint"_a, ReleaseGIL())
         .def("drawCircle", py::overload_cast<SkPoint, SkScalar, const SkPaint &>(&SkCanvas::drawCircle), "center"_a,
-             "radius"_a, "paint"_a)
-        .def("drawArc", &SkCanvas::drawArc, "oval"_a, "startAngle"_a, "sweepAngle"_a, "useCenter"_a, "paint"_a)
-        .def("drawRoundRect", &SkCanvas::drawRoundRect, "rect"_a, "rx"_a, "ry"_a, "paint"_a)
-        .def("drawPath", &SkCanvas::drawPath, "path"_a, "paint"_a)
+             "radius"_a, "paint"_a, ReleaseGIL())
+        .def("drawArc", &SkCanvas::drawArc, "oval"_a, "startAngle"_a, "sweepAngle"_a, "useCenter"_a, "paint"_a,
+             ReleaseGIL())
+        .def("drawRoundRect", &SkCanvas::drawRoundRect, "rect"_a, "rx"_a, "ry"_a, "paint"_a, ReleaseGIL())
+        .def("drawPath", &SkCanvas::drawPath, "path"_a, "paint"_a, ReleaseGIL())
         .def("drawImage", py::overload_cast<const sk_sp<SkImage> &, SkScalar, SkScalar>(&SkCanvas::drawImage),
-             "image"_a, "left"_a, "top"_a);
+             "image"_a, "left"_a, "top"_a, ReleaseGIL());
 
     static constexpr SkSamplingOptions dso;
 
@@ -281,20 +300,20 @@ void initCanvas(py::module &m)
         .def("drawImage",
              py::overload_cast<const sk_sp<SkImage> &, SkScalar, SkScalar, const SkSamplingOptions &, const SkPaint *>(
                  &SkCanvas::drawImage),
-             "image"_a, "left"_a, "top"_a, "sampling"_a = dso, "paint"_a = nullptr)
+             "image"_a, "left"_a, "top"_a, "sampling"_a = dso, "paint"_a = nullptr, ReleaseGIL())
         .def("drawImageRect",
              py::overload_cast<const sk_sp<SkImage> &, const SkRect &, const SkRect &, const SkSamplingOptions &,
                                const SkPaint *, SkCanvas::SrcRectConstraint>(&SkCanvas::drawImageRect),
              "image"_a, "src"_a, "dst"_a, "sampling"_a = dso, "paint"_a = nullptr,
-             "constraint"_a = SkCanvas::SrcRectConstraint::kFast_SrcRectConstraint)
+             "constraint"_a = SkCanvas::SrcRectConstraint::kFast_SrcRectConstraint, ReleaseGIL())
         .def("drawImageRect",
              py::overload_cast<const sk_sp<SkImage> &, const SkRect &, const SkSamplingOptions &, const SkPaint *>(
                  &SkCanvas::drawImageRect),
-             "image"_a, "dst"_a, "sampling"_a = dso, "paint"_a = nullptr)
+             "image"_a, "dst"_a, "sampling"_a = dso, "paint"_a = nullptr, ReleaseGIL())
         .def("drawImageNine",
              py::overload_cast<const SkImage *, const SkIRect &, const SkRect &, SkFilterMode, const SkPaint *>(
                  &SkCanvas::drawImageNine),
-             "image"_a, "center"_a, "dst"_a, "filter"_a, "paint"_a = nullptr);
+             "image"_a, "center"_a, "dst"_a, "filter"_a, "paint"_a = nullptr, ReleaseGIL());
 
     py::class_<PyLattice> Lattice(Canvas, "Lattice");
 
@@ -384,18 +403,18 @@ void initCanvas(py::module &m)
         .def("drawImageLattice",
              py::overload_cast<const SkImage *, const SkCanvas::Lattice &, const SkRect &, SkFilterMode,
                                const SkPaint *>(&SkCanvas::drawImageLattice),
-             "image"_a, "lattice"_a, "dst"_a, "filter"_a = SkFilterMode::kNearest, "paint"_a = nullptr)
+             "image"_a, "lattice"_a, "dst"_a, "filter"_a = SkFilterMode::kNearest, "paint"_a = nullptr, ReleaseGIL())
         .def(
             "drawSimpleText",
             [](SkCanvas &self, const std::string &text, const SkTextEncoding &encoding, const SkScalar &x,
                const SkScalar &y, const SkFont &font, const SkPaint &paint)
             { self.drawSimpleText(text.c_str(), text.size(), encoding, x, y, font, paint); },
             "Draws *text* at (*x*, *y*) using *font* and *paint*.", "text"_a, "encoding"_a, "x"_a, "y"_a, "font"_a,
-            "paint"_a)
+            "paint"_a, ReleaseGIL())
         .def(
             "drawString",
             py::overload_cast<const char[], SkScalar, SkScalar, const SkFont &, const SkPaint &>(&SkCanvas::drawString),
-            "text"_a, "x"_a, "y"_a, "font"_a, "paint"_a)
+            "text"_a, "x"_a, "y"_a, "font"_a, "paint"_a, ReleaseGIL())
         .def(
             "drawGlyphs",
             [](SkCanvas &self, const std::vector<SkGlyphID> &glyphs, const std::vector<SkPoint> &positions,
@@ -412,7 +431,33 @@ void initCanvas(py::module &m)
                 Draws *glyphs*, at *positions* relative to *origin* styled with *font* and *paint* with supporting
                 *utf8text* and *clusters* information.
             )doc",
-            "glyphs"_a, "positions"_a, "clusters"_a, "utf8text"_a, "origin"_a, "font"_a, "paint"_a)
+            "glyphs"_a, "positions"_a, "clusters"_a, "utf8text"_a, "origin"_a, "font"_a, "paint"_a, ReleaseGIL())
+        .def(
+            "drawGlyphs",
+            [](SkCanvas &self, const GlyphArray &glyphs, const FloatArray &positions, const SkPoint &origin,
+               const SkFont &font, const SkPaint &paint)
+            {
+                const size_t count = ndarrayRows(glyphs, 1, "glyphs");
+                if (positions.ndim() != 2 || (positions.shape(1) != 2 && positions.shape(1) != 4))
+                    throw py::value_error("positions must have shape=(N, 2) or (N, 4).");
+                const bool isXform = positions.shape(1) == 4;
+                if (ndarrayRows(positions, isXform ? 4 : 2, "positions") != count)
+                    throw py::value_error("glyphs and positions must be the same length");
+                py::gil_scoped_release release;
+                if (isXform)
+                    self.drawGlyphs(count, glyphs.data(), reinterpret_cast<const SkRSXform *>(positions.data()),
+                                    origin, font, paint);
+                else
+                    self.drawGlyphs(count, glyphs.data(), reinterpret_cast<const SkPoint *>(positions.data()), origin,
+                                    font, paint);
+            },
+            R"doc(
+                Draws *glyphs*, a uint16 array, relative to *origin* styled with *font* and *paint*. *positions* is a
+                float32 array, either of shape (N, 2) with the position of each glyph, or of shape (N, 4) with the
+                :py:class:`RSXform` values (scos, ssin, tx, ty) of each glyph, like the output of
+                :py:meth:`PathMeasure.sample` with ``rsxform=True``. The arrays are used without copying.
+            )doc",
+            "glyphs"_a.noconvert(), "positions"_a.noconvert(), "origin"_a, "font"_a, "paint"_a)
         .def(
             "drawGlyphs",
             [](SkCanvas &self, const std::vector<SkGlyphID> &glyphs, const std::vector<SkPoint> &positions,
@@ -424,7 +469,7 @@ void initCanvas(py::module &m)
                 self.drawGlyphs(count, glyphs.data(), positions.data(), origin, font, paint);
             },
             "Draws *glyphs*, at *positions* relative to *origin* styled with *font* and *paint*.", "glyphs"_a,
-            "positions"_a, "origin"_a, "font"_a, "paint"_a)
+            "positions"_a, "origin"_a, "font"_a, "paint"_a, ReleaseGIL())
         .def(
             "drawGlyphs",
             [](SkCanvas &self, const std::vector<SkGlyphID> &glyphs, const std::vector<SkRSXform> &xforms,
@@ -436,16 +481,42 @@ void initCanvas(py::module &m)
                 self.drawGlyphs(count, glyphs.data(), xforms.data(), origin, font, paint);
             },
             "Draws *glyphs*, with *xforms* relative to *origin* styled with *font* and *paint*.", "glyphs"_a,
-            "xforms"_a, "origin"_a, "font"_a, "paint"_a)
+            "xforms"_a, "origin"_a, "font"_a, "paint"_a, ReleaseGIL())
         .def("drawTextBlob",
              py::overload_cast<const sk_sp<SkTextBlob> &, SkScalar, SkScalar, const SkPaint &>(&SkCanvas::drawTextBlob),
-             "blob"_a, "x"_a, "y"_a, "paint"_a)
+             "blob"_a, "x"_a, "y"_a, "paint"_a, ReleaseGIL())
         .def("drawPicture",
              py::overload_cast<const sk_sp<SkPicture> &, const SkMatrix *, const SkPaint *>(&SkCanvas::drawPicture),
-             "picture"_a, "matrix"_a = nullptr, "paint"_a = nullptr)
+             "picture"_a, "matrix"_a = nullptr, "paint"_a = nullptr, ReleaseGIL())
+        .def("drawDrawable", py::overload_cast<SkDrawable *, const SkMatrix *>(&SkCanvas::drawDrawable),
+             "drawable"_a.none(false), "matrix"_a = nullptr, ReleaseGIL())
+        .def("drawDrawable", py::overload_cast<SkDrawable *, SkScalar, SkScalar>(&SkCanvas::drawDrawable),
+             "drawable"_a.none(false), "x"_a, "y"_a, ReleaseGIL())
         .def("drawVertices",
              py::overload_cast<const sk_sp<SkVertices> &, SkBlendMode, const SkPaint &>(&SkCanvas::drawVertices),
-             "vertices"_a, "mode"_a, "paint"_a)
+             "vertices"_a, "mode"_a, "paint"_a, ReleaseGIL())
+        .def(
+            "drawPatch",
+            [](SkCanvas &self, const FloatArray &cubics, const std::optional<ColorArray> &colors,
+               const std::optional<FloatArray> &texCoords, const SkBlendMode &mode, const SkPaint &paint)
+            {
+                if (ndarrayRows(cubics, 2, "cubics") != 12)
+                    throw py::value_error("cubics must be an array of 12 points");
+                if (colors && ndarrayRows(*colors, 1, "colors") != 4)
+                    throw py::value_error("colors must be an array of 4 colors");
+                if (texCoords && ndarrayRows(*texCoords, 2, "texCoords") != 4)
+                    throw py::value_error("texCoords must be an array of 4 points");
+                py::gil_scoped_release release;
+                self.drawPatch(reinterpret_cast<const SkPoint *>(cubics.data()), colors ? colors->data() : nullptr,
+                               texCoords ? reinterpret_cast<const SkPoint *>(texCoords->data()) : nullptr, mode,
+                               paint);
+            },
+            R"doc(
+                Draws a Coons patch with the 12 points of *cubics*, the 4 corner *colors* and the 4 *texCoords*.
+                *cubics* and *texCoords* are float32 arrays of shape (N, 2), and *colors* is a uint32 array of ARGB
+                colors. The arrays are used without copying.
+            )doc",
+            "cubics"_a.noconvert(), "colors"_a.noconvert(), "texCoords"_a.noconvert(), "mode"_a, "paint"_a)
         .def(
             "drawPatch",
             [](SkCanvas &self, const std::vector<SkPoint> &cubics, const std::optional<std::vector<SkColor>> &colors,
@@ -461,7 +532,30 @@ void initCanvas(py::module &m)
                 self.drawPatch(cubics.data(), colors ? colors->data() : nullptr,
                                texCoords ? texCoords->data() : nullptr, mode, paint);
             },
-            "cubics"_a, "colors"_a, "texCoords"_a, "mode"_a, "paint"_a)
+            "cubics"_a, "colors"_a, "texCoords"_a, "mode"_a, "paint"_a, ReleaseGIL())
+        .def(
+            "drawAtlas",
+            [](SkCanvas &self, const SkImage *atlas, const std::optional<FloatArray> &xform, const FloatArray &tex,
+               const std::optional<ColorArray> &colors, const SkBlendMode &mode, const SkSamplingOptions &sampling,
+               const SkRect *cullRect, const SkPaint *paint)
+            {
+                const size_t count = ndarrayRows(tex, 4, "tex");
+                if ((xform && ndarrayRows(*xform, 4, "xform") != count) ||
+                    (colors && ndarrayRows(*colors, 1, "colors") != count))
+                    throw py::value_error("xform and colors must be the same length as tex.");
+                py::gil_scoped_release release;
+                self.drawAtlas(atlas, xform ? reinterpret_cast<const SkRSXform *>(xform->data()) : nullptr,
+                               reinterpret_cast<const SkRect *>(tex.data()), colors ? colors->data() : nullptr, count,
+                               mode, sampling, cullRect, paint);
+            },
+            R"doc(
+                Draws a set of sprites from *atlas*, defined by *xform*, *tex*, and *colors* using *mode* and
+                *sampling*. *xform* is a float32 array of shape (N, 4) with the :py:class:`RSXform` values (scos, ssin,
+                tx, ty), *tex* is a float32 array of shape (N, 4) with the rects (left, top, right, bottom), and
+                *colors* is a uint32 array of ARGB colors. The arrays are used without copying.
+            )doc",
+            "atlas"_a, "xform"_a.noconvert(), "tex"_a.noconvert(), "colors"_a.noconvert(), "mode"_a, "sampling"_a,
+            "cullRect"_a = nullptr, "paint"_a = nullptr)
         .def(
             "drawAtlas",
             [](SkCanvas &self, const SkImage *atlas, const std::optional<std::vector<SkRSXform>> &xform,
@@ -475,7 +569,7 @@ void initCanvas(py::module &m)
             },
             "Draws a set of sprites from *atlas*, defined by *xform*, *tex*, and *colors* using *mode* and *sampling*.",
             "atlas"_a, "xform"_a, "tex"_a, "colors"_a, "mode"_a, "sampling"_a, "cullRect"_a = nullptr,
-            "paint"_a = nullptr)
+            "paint"_a = nullptr, ReleaseGIL())
         // .def("drawAnnotation",
         //      py::overload_cast<const SkRect &, const char[], const sk_sp<SkData> &>(&SkCanvas::drawAnnotation),
         //      "rect"_a, "key"_a, "value"_a)
@@ -487,11 +581,11 @@ void initCanvas(py::module &m)
             "drawParagraph",
             [](SkCanvas &self, skia::textlayout::Paragraph *const paragraph, const SkScalar &x, const SkScalar &y)
             { paragraph->paint(&self, x, y); },
-            "Draws the *paragraph* at the given *x* and *y* position.", "paragraph"_a, "x"_a, "y"_a)
+            "Draws the *paragraph* at the given *x* and *y* position.", "paragraph"_a, "x"_a, "y"_a, ReleaseGIL())
         .def("drawShadow", &SkShadowUtils::DrawShadow,
              "Draw an offset spot shadow and outlining ambient shadow for the given *path* using a disc light.",
              "path"_a, "zPlaneParams"_a, "lightPos"_a, "lightRadius"_a, "ambientColor"_a, "spotColor"_a,
-             "flags"_a = SkShadowFlags::kNone_ShadowFlag)
+             "flags"_a = SkShadowFlags::kNone_ShadowFlag, ReleaseGIL())
         .def("__str__",
              [](const SkCanvas &self)
              {
@@ -501,7 +595,7 @@ void initCanvas(py::module &m)
 
     py::class_<SkAutoCanvasRestore>(m, "AutoCanvasRestore")
         .def(py::init<SkCanvas *, bool>(), "canvas"_a, "doSave"_a = true, py::keep_alive<1, 2>())
-        .def("restore", &SkAutoCanvasRestore::restore)
+        .def("restore", &SkAutoCanvasRestore::restore, ReleaseGIL())
         .def("__enter__", [](SkAutoCanvasRestore &) {})
         .def("__exit__", [](SkAutoCanvasRestore &self, py::args) { self.restore(); });
 
@@ -517,7 +611,8 @@ void initCanvas(py::module &m)
            const SkPaint &paint, const SkTextEncoding &encoding, const SkTextUtils::Align &align)
         { SkTextUtils::Draw(self, text.c_str(), text.size(), encoding, x, y, font, paint, align); },
         "Draws the *text* at (*x*, *y*) using the given *font* and *paint* useing SkTextUtils.", "text"_a, "x"_a, "y"_a,
-        "font"_a, "paint"_a, "encoding"_a = SkTextEncoding::kUTF8, "align"_a = SkTextUtils::Align::kLeft_Align);
+        "font"_a, "paint"_a, "encoding"_a = SkTextEncoding::kUTF8, "align"_a = SkTextUtils::Align::kLeft_Align,
+        ReleaseGIL());
 
     // py::class_<SkSVGCanvas>(m, "SVGCanvas")
     //     .def_static("Make", &SkSVGCanvas::Make,
@@ -16,8 +16,7 @@
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
-sk_sp<SkData> encodeToData(const SkImage *self, const SkEncodedImageFormat &format = SkEncodedImageFormat::kPNG,
-                           const int &quality = 100)
+sk_sp<SkData> encodeToData(const SkImage *self, const SkEncodedImageFormat &format, const int &quality)
 { // taken from old SkImageEncoder.cpp
     switch (format)
     {
@@ -223,7 +222,12 @@ void initImage(py::module &m)
                     SkImageInfo imgInfo = self.imageInfo();
                     py::bytes bytes(nullptr, imgInfo.computeMinByteSize());
                     void *ptr = reinterpret_cast<void *>(PyBytes_AS_STRING(bytes.ptr()));
-                    if (self.readPixels(imgInfo, ptr, imgInfo.minRowBytes(), 0, 0))
+                    bool success;
+                    {
+                        py::gil_scoped_release release;
+                        success = self.readPixels(imgInfo, ptr, imgInfo.minRowBytes(), 0, 0);
+                    }
+                    if (success)
                         return bytes;
                     throw std::runtime_error("Failed to read pixels.");
                 }
@@ -289,7 +293,11 @@ void initImage(py::module &m)
             [](const SkImage &self, const py::object &fp, const SkEncodedImageFormat &encodedImageFormat,
                const int &quality)
             {
-                sk_sp<SkData> data = encodeToData(&self, encodedImageFormat, quality);
+                sk_sp<SkData> data;
+                {
+                    py::gil_scoped_release release;
+                    data = encodeToData(&self, encodedImageFormat, quality);
+                }
                 if (!data)
                     throw py::value_error("Failed to encode image.");
                 if (py::hasattr(fp, "write"))
@@ -297,8 +305,13 @@ void initImage(py::module &m)
                 else
                 {
                     std::string path = fp.cast<std::string>();
-                    SkFILEWStream stream(path.c_str());
-                    if (!stream.write(data->data(), data->size()))
+                    bool success;
+                    {
+                        py::gil_scoped_release release;
+                        SkFILEWStream stream(path.c_str());
+                        success = stream.write(data->data(), data->size());
+                    }
+                    if (!success)
                         throw py::value_error("Failed to write data to file {}"_s.format(path));
                 }
             },
@@ -336,7 +349,7 @@ void initImage(py::module &m)
                               sk_sp<SkColorSpace>, SkSurfaceProps>(&SkImages::DeferredFromPicture),
             "picture"_a, "dimensions"_a, "matrix"_a = nullptr, "paint"_a = nullptr,
             "bitDepth"_a = SkImages::BitDepth::kU8, "colorSpace"_a = nullptr, "props"_a = SkSurfaceProps{})
-        .def_static("RasterFromPixmapCopy", &SkImages::RasterFromPixmapCopy, "pixmap"_a)
+        .def_static("RasterFromPixmapCopy", &SkImages::RasterFromPixmapCopy, "pixmap"_a, ReleaseGIL())
         .def_static(
             "RasterFromPixmap",
             [](const SkPixmap &pixmap) { return SkImages::RasterFromPixmap(pixmap, nullptr, nullptr); },
@@ -390,9 +403,9 @@ void initImage(py::module &m)
                const int &srcX, const int &srcY, const SkImage::CachingHint &cachingHint)
             {
                 const py::buffer_info bufInfo = dstPixels.request();
-                return self.readPixels(nullptr, dstInfo, bufInfo.ptr,
-                                       validateImageInfo_Buffer(dstInfo, bufInfo, dstRowBytes), srcX, srcY,
-                                       cachingHint);
+                const size_t rowBytes = validateImageInfo_Buffer(dstInfo, bufInfo, dstRowBytes);
+                py::gil_scoped_release release;
+                return self.readPixels(nullptr, dstInfo, bufInfo.ptr, rowBytes, srcX, srcY, cachingHint);
             },
             "Copies *dstInfo* pixels starting from (*srcX*, *srcY*) to *dstPixels* buffer.", "dstInfo"_a, "dstPixels"_a,
             "dstRowBytes"_a = 0, "srcX"_a = 0, "srcY"_a = 0, "cachingHint"_a = SkImage::CachingHint::kAllow_CachingHint)
@@ -402,10 +415,11 @@ void initImage(py::module &m)
                const SkImage::CachingHint &cachingHint)
             { return self.readPixels(nullptr, dst, srcX, srcY, cachingHint); },
             "Copies pixels starting from (*srcX*, *srcY*) to *dst* :py:class:`Pixmap`.", "dst"_a, "srcX"_a = 0,
-            "srcY"_a = 0, "cachingHint"_a = SkImage::CachingHint::kAllow_CachingHint)
+            "srcY"_a = 0, "cachingHint"_a = SkImage::CachingHint::kAllow_CachingHint, ReleaseGIL())
         .def("scalePixels", &SkImage::scalePixels, "dst"_a, "sampling"_a = dso,
-             "cachingHint"_a = SkImage::kAllow_CachingHint)
-        .def("encodeToData", &encodeToData, "encodedImageFormat"_a = SkEncodedImageFormat::kPNG, "quality"_a = 100)
+             "cachingHint"_a = SkImage::kAllow_CachingHint, ReleaseGIL())
+        .def("encodeToData", &encodeToData, "encodedImageFormat"_a = SkEncodedImageFormat::kPNG, "quality"_a = 100,
+             ReleaseGIL())
         .def("refEncodedData", &SkImage::refEncodedData)
         .def(
             "makeSubset", [](const SkImage &self, const SkIRect &subset) { return self.makeSubset(nullptr, subset); },
@@ -417,7 +431,7 @@ void initImage(py::module &m)
             "makeRasterImage",
             [](const SkImage &self, const SkImage::CachingHint &cachingHint)
             { return self.makeRasterImage(nullptr, cachingHint); },
-            "cachingHint"_a = SkImage::CachingHint::kDisallow_CachingHint)
+            "cachingHint"_a = SkImage::CachingHint::kDisallow_CachingHint, ReleaseGIL())
         .def(
             "makeWithFilter",
             [](const SkImage &self, const SkImageFilter *filter, const SkIRect *subset, const SkIRect *clipBounds)
@@ -425,8 +439,12 @@ void initImage(py::module &m)
                 SkIRect outSubset;
                 SkIPoint offset;
                 const SkIRect &selfBounds = self.bounds();
-                sk_sp<SkImage> result = self.makeWithFilter(nullptr, filter, subset ? *subset : selfBounds,
-                                                            clipBounds ? *clipBounds : selfBounds, &outSubset, &offset);
+                sk_sp<SkImage> result;
+                {
+                    py::gil_scoped_release release;
+                    result = self.makeWithFilter(nullptr, filter, subset ? *subset : selfBounds,
+                                                 clipBounds ? *clipBounds : selfBounds, &outSubset, &offset);
+                }
                 if (result)
                     return py::make_tuple(result, outSubset, offset);
                 throw std::runtime_error("Image filtering failed.");
@@ -437,13 +455,13 @@ void initImage(py::module &m)
         .def(
             "makeColorSpace",
             [](const SkImage &self, const sk_sp<SkColorSpace> &target) { return self.makeColorSpace(nullptr, target); },
-            "Creates :py:class:`Image` in *target* colorspace.", "target"_a)
+            "Creates :py:class:`Image` in *target* colorspace.", "target"_a, ReleaseGIL())
         .def(
             "makeColorTypeAndColorSpace",
             [](const SkImage &self, const SkColorType &targetColorType, const sk_sp<SkColorSpace> &targetColorSpace)
             { return self.makeColorTypeAndColorSpace(nullptr, targetColorType, targetColorSpace); },
             "Creates :py:class:`Image` in *targetColorType* and *targetColorSpace*.", "targetColorType"_a,
-            "targetColorSpace"_a)
+            "targetColorSpace"_a, ReleaseGIL())
         .def("reinterpretColorSpace", &SkImage::reinterpretColorSpace, "newColorSpace"_a)
         .def(
             "bitmap",
@@ -465,7 +483,7 @@ void initImage(py::module &m)
             },
             "Creates a new :py:class:`Bitmap` from :py:class:`Image` with a copy of pixels.",
             "colorType"_a = SkColorType::kUnknown_SkColorType, "alphaType"_a = SkAlphaType::kUnknown_SkAlphaType,
-            "colorSpace"_a = py::none())
+            "colorSpace"_a = py::none(), ReleaseGIL())
         .def(
             "resize",
             [](const SkImage &self, const int &width, const int &height, const SkSamplingOptions &sampling,
@@ -482,11 +500,15 @@ void initImage(py::module &m)
                 throw std::runtime_error("Failed to resize image.");
             },
             "Creates a new :py:class:`Image` by scaling pixels to fit *width* and *height*.", "width"_a, "height"_a,
-            "sampling"_a = dso, "cachingHint"_a = SkImage::kAllow_CachingHint)
+            "sampling"_a = dso, "cachingHint"_a = SkImage::kAllow_CachingHint, ReleaseGIL())
         .def("_repr_png_",
              [](const SkImage &self)
              {
-                 sk_sp<SkData> data = encodeToData(&self);
+                 sk_sp<SkData> data;
+                 {
+                     py::gil_scoped_release release;
+                     data = encodeToData(&self);
+                 }
                  if (!data)
                      throw std::runtime_error("Failed to encode image.");
                  return py::bytes(static_cast<const char *>(data->data()), data->size());
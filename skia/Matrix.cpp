@@ -8,6 +8,17 @@
 
 typedef py::array_t<SkScalar> ndarray;
 
+// Returns the array that the rows of *src* (of shape (N, 2)) are mapped into, which is *out* if given, or *src* itself.
+FloatArray mapDestination(const FloatArray &src, const std::optional<FloatArray> &out, const char *name)
+{
+    const size_t count = ndarrayRows(src, 2, name);
+    if (!out)
+        return src;
+    if (ndarrayRows(*out, 2, "out") != count)
+        throw py::value_error("out must have the same shape as {}."_s.format(name));
+    return *out;
+}
+
 SkScalar getItem(const SkMatrix &m, int index)
 {
     if (index < 0 || 9 <= index)
@@ -315,6 +326,28 @@ void initMatrix(py::module &m)
             },
             "affine"_a)
         .def("normalizePerspective", &SkMatrix::normalizePerspective)
+        .def(
+            "mapPoints",
+            [](const SkMatrix &matrix, const FloatArray &pts, const std::optional<FloatArray> &out)
+            {
+                FloatArray dst = mapDestination(pts, out, "pts");
+                SkPoint *dstPoints = reinterpret_cast<SkPoint *>(dst.mutable_data());
+                const SkPoint *srcPoints = reinterpret_cast<const SkPoint *>(pts.data());
+                {
+                    py::gil_scoped_release release;
+                    matrix.mapPoints(dstPoints, srcPoints, pts.shape(0));
+                }
+                return dst;
+            },
+            R"doc(
+                Maps a float32 numpy array of shape=(N, 2) of points in place, or into *out* if given, and returns the
+                mapped array. No list of :py:class:`Point` is created, and the GIL is released while mapping.
+
+                :param pts: float32 numpy array of shape=(N, 2) to transform
+                :param out: float32 numpy array of the same shape to store the mapped points in
+                :return: *out* if given, else *pts*
+            )doc",
+            "pts"_a.noconvert(), "out"_a.noconvert() = py::none())
         .def(
             "mapPoints",
             [](const SkMatrix &matrix, std::vector<SkPoint> &pts)
@@ -355,6 +388,28 @@ void initMatrix(py::module &m)
         .def("mapPoint", &SkMatrix::mapPoint, "pt"_a)
         .def("mapXY", py::overload_cast<SkScalar, SkScalar>(&SkMatrix::mapXY, py::const_), "x"_a, "y"_a)
         .def("mapOrigin", &SkMatrix::mapOrigin)
+        .def(
+            "mapVectors",
+            [](const SkMatrix &matrix, const FloatArray &vecs, const std::optional<FloatArray> &out)
+            {
+                FloatArray dst = mapDestination(vecs, out, "vecs");
+                SkVector *dstVectors = reinterpret_cast<SkVector *>(dst.mutable_data());
+                const SkVector *srcVectors = reinterpret_cast<const SkVector *>(vecs.data());
+                {
+                    py::gil_scoped_release release;
+                    matrix.mapVectors(dstVectors, srcVectors, vecs.shape(0));
+                }
+                return dst;
+            },
+            R"doc(
+                Maps a float32 numpy array of shape=(N, 2) of vectors in place, or into *out* if given, treating
+                translation as zero, and returns the mapped array. The GIL is released while mapping.
+
+                :param vecs: float32 numpy array of shape=(N, 2) to transform
+                :param out: float32 numpy array of the same shape to store the mapped vectors in
+                :return: *out* if given, else *vecs*
+            )doc",
+            "vecs"_a.noconvert(), "out"_a.noconvert() = py::none())
         .def(
             "mapVectors",
             [](const SkMatrix &matrix, std::vector<SkVector> &vecs)
@@ -450,6 +505,43 @@ void initMatrix(py::module &m)
         .def_static("I", &SkMatrix::I)
         .def_static("InvalidMatrix", &SkMatrix::InvalidMatrix)
         .def_static("Concat", &SkMatrix::Concat, "a"_a, "b"_a)
+        .def_static(
+            "MapPoints",
+            [](const py::array_t<SkScalar, py::array::c_style | py::array::forcecast> &matrices, const FloatArray &pts,
+               const std::optional<FloatArray> &out)
+            {
+                if (matrices.ndim() != 3 || matrices.shape(1) != 3 || matrices.shape(2) != 3)
+                    throw py::value_error("matrices must be an array of shape (K, 3, 3).");
+                if (pts.ndim() != 3 || pts.shape(0) != matrices.shape(0) || pts.shape(2) != 2)
+                    throw py::value_error("pts must be an array of shape (K, N, 2).");
+                if (out && (out->ndim() != 3 || out->shape(0) != pts.shape(0) || out->shape(1) != pts.shape(1) ||
+                            out->shape(2) != 2))
+                    throw py::value_error("out must have the same shape as pts.");
+                FloatArray dst = out ? *out : pts;
+                SkPoint *dstPoints = reinterpret_cast<SkPoint *>(dst.mutable_data());
+                const SkPoint *srcPoints = reinterpret_cast<const SkPoint *>(pts.data());
+                const SkScalar *values = matrices.data();
+                const py::ssize_t count = pts.shape(0), size = pts.shape(1);
+
+                py::gil_scoped_release release;
+                SkMatrix matrix;
+                for (py::ssize_t i = 0; i < count; ++i)
+                    matrix.set9(values + 9 * i).mapPoints(dstPoints + size * i, srcPoints + size * i, size);
+                return dst;
+            },
+            R"doc(
+                Maps the points in ``pts[i]`` by the matrix ``matrices[i]`` for every *i*, in place or into *out* if
+                given, and returns the mapped array. This transforms many point sets, like the vertices of many
+                entities, in a single call without creating any :py:class:`Matrix` or :py:class:`Point`. The GIL is
+                released while mapping.
+
+                :param matrices: numpy array of shape=(K, 3, 3), where each matrix is in the order of
+                    :py:meth:`get9`
+                :param pts: float32 numpy array of shape=(K, N, 2) to transform
+                :param out: float32 numpy array of the same shape to store the mapped points in
+                :return: *out* if given, else *pts*
+            )doc",
+            "matrices"_a, "pts"_a.noconvert(), "out"_a.noconvert() = py::none())
         .def(
             "__matmul__", [](const SkMatrix &matrix, const SkMatrix &other) { return matrix * other; },
             py::is_operator(),
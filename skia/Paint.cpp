@@ -159,6 +159,27 @@ void initPaint(py::module &m)
         .def("refImageFilter", &SkPaint::refImageFilter)
         .def("setImageFilter", &SkPaint::setImageFilter, "imageFilter"_a)
         .def("nothingToDraw", &SkPaint::nothingToDraw)
+        .def("canComputeFastBounds", &SkPaint::canComputeFastBounds)
+        .def(
+            "computeFastBounds",
+            [](const SkPaint &paint, const SkRect &orig) -> SkRect
+            {
+                SkRect storage;
+                return paint.computeFastBounds(orig, &storage);
+            },
+            R"doc(
+                Returns the bounds of what is drawn with this paint for geometry with bounds *orig*, including the
+                stroke, mask filter and image filter. Only valid if :py:meth:`canComputeFastBounds` is ``True``.
+            )doc",
+            "orig"_a)
+        .def(
+            "computeFastStrokeBounds",
+            [](const SkPaint &paint, const SkRect &orig) -> SkRect
+            {
+                SkRect storage;
+                return paint.computeFastStrokeBounds(orig, &storage);
+            },
+            "Same as :py:meth:`computeFastBounds`, but as if the paint had the stroke style.", "orig"_a)
         .def(
             "__str__",
             [](const SkPaint &paint)
@@ -85,6 +85,40 @@ void initPath(py::module &m)
                                     isVolatile);
             },
             "pts"_a, "vbs"_a, "ws"_a, "ft"_a, "isVolatile"_a = false)
+        .def_static(
+            "fromarrays",
+            [](const py::array_t<uint8_t, py::array::c_style | py::array::forcecast> &verbs,
+               const py::array_t<float, py::array::c_style | py::array::forcecast> &points,
+               const std::optional<py::array_t<float, py::array::c_style | py::array::forcecast>> &weights,
+               const SkPathFillType &ft, const bool &isVolatile)
+            {
+                const int verbCount = ndarrayRows(verbs, 1, "verbs"), pointCount = ndarrayRows(points, 2, "points"),
+                          weightCount = weights ? ndarrayRows(*weights, 1, "weights") : 0;
+                SkPath path;
+                {
+                    py::gil_scoped_release release;
+                    path = SkPath::Make(reinterpret_cast<const SkPoint *>(points.data()), pointCount, verbs.data(),
+                                        verbCount, weights ? weights->data() : nullptr, weightCount, ft, isVolatile);
+                }
+                if (verbCount && path.isEmpty())
+                    throw py::value_error("verbs, points and weights do not describe a valid path.");
+                // SkPath::Make returns a default path for no verbs, which drops the fill type.
+                path.setFillType(ft);
+                path.setIsVolatile(isVolatile);
+                return path;
+            },
+            R"doc(
+                Creates a :py:class:`Path` from the arrays returned by :py:meth:`toarrays`. The arrays are converted to
+                the right type if needed, and their data is copied into the path at once.
+
+                :param verbs: uint8 array of :py:class:`PathVerb` values.
+                :param points: float32 array of shape (N, 2).
+                :param weights: float32 array with the weight of each conic verb, or ``None`` if there are no conics.
+                :param ft: The fill type of the path.
+                :param isVolatile: Whether the path is volatile.
+            )doc",
+            "verbs"_a, "points"_a, "weights"_a = py::none(), "ft"_a = SkPathFillType::kWinding,
+            "isVolatile"_a = false)
         .def_static("Rect", &SkPath::Rect, "rect"_a, "dir"_a = SkPathDirection::kCW, "startIndex"_a = 0)
         .def_static("Oval", py::overload_cast<const SkRect &, SkPathDirection>(&SkPath::Oval), "r"_a,
                     "dir"_a = SkPathDirection::kCW)
@@ -97,6 +131,17 @@ void initPath(py::module &m)
                     "dir"_a, "startIndex"_a)
         .def_static("RRect", py::overload_cast<const SkRect &, SkScalar, SkScalar, SkPathDirection>(&SkPath::RRect),
                     "bounds"_a, "rx"_a, "ry"_a, "dir"_a = SkPathDirection::kCW)
+        .def_static(
+            "Polygon",
+            [](const FloatArray &pts, const bool &isClosed, const SkPathFillType &fillType, const bool &isVolatile)
+            {
+                const size_t count = ndarrayRows(pts, 2, "points");
+                py::gil_scoped_release release;
+                return SkPath::Polygon(reinterpret_cast<const SkPoint *>(pts.data()), count, isClosed, fillType,
+                                       isVolatile);
+            },
+            "Create a polygonal path from a float32 array of shape (N, 2).", "points"_a.noconvert(), "isClosed"_a,
+            "ft"_a = SkPathFillType::kWinding, "isVolatile"_a = false)
         .def_static(
             "Polygon",
             [](const std::vector<SkPoint> &pts, const bool &isClosed, const SkPathFillType &fillType,
@@ -171,7 +216,7 @@ void initPath(py::module &m)
             [](const SkPath &self, int max)
             {
                 if (max < 0)
-                    max = self.countVerbs();
+                    max = self.countPoints();
                 std::vector<SkPoint> points(max);
                 int length = self.getPoints(points.data(), max);
                 if (length < max)
@@ -183,7 +228,35 @@ void initPath(py::module &m)
                 *max* points. If *max* is negative, return all points.
             )doc",
             "max"_a = -1)
-        .def("countVerbs", &SkPath::countVerbs);
+        .def("countVerbs", &SkPath::countVerbs)
+        .def(
+            "toarrays",
+            [](const SkPath &self)
+            {
+                const int verbCount = self.countVerbs(), pointCount = self.countPoints();
+                py::array_t<uint8_t> verbs(verbCount);
+                py::array_t<float> points({py::ssize_t(pointCount), py::ssize_t(2)});
+                std::vector<float> weights;
+                {
+                    py::gil_scoped_release release;
+                    self.getVerbs(verbs.mutable_data(), verbCount);
+                    self.getPoints(reinterpret_cast<SkPoint *>(points.mutable_data()), pointCount);
+                    if (self.getSegmentMasks() & SkPath::kConic_SegmentMask)
+                    {
+                        SkPath::Iter it(self, false);
+                        SkPoint pts[4];
+                        for (SkPath::Verb verb; (verb = it.next(pts)) != SkPath::kDone_Verb;)
+                            if (verb == SkPath::kConic_Verb)
+                                weights.push_back(it.conicWeight());
+                    }
+                }
+                return py::make_tuple(verbs, points, py::array_t<float>(weights.size(), weights.data()));
+            },
+            R"doc(
+                Returns the geometry of the :py:class:`Path` as a tuple of three numpy arrays: the verbs as uint8
+                :py:class:`PathVerb` values, the points as float32 array of shape (N, 2), and the weights of the conic
+                verbs as float32 array. Use :py:meth:`fromarrays` to create a path from them.
+            )doc");
 
     py::enum_<SkPath::Verb>(Path, "Verb")
         .value("kMove_Verb", SkPath::Verb::kMove_Verb)
@@ -596,7 +669,7 @@ void initPath(py::module &m)
                 Return the resultant path of applying the *op* to this path and the specified path. If the operation
                 fails, throws a runtime error.
             )doc",
-            "two"_a, "op"_a)
+            "two"_a, "op"_a, ReleaseGIL())
         .def(
             "iop",
             [](SkPath &self, const SkPath &other, SkPathOp op)
@@ -609,15 +682,15 @@ void initPath(py::module &m)
                 Apply the *op* to this path and the specified path in place and return itself. If the operation fails,
                 throws a runtime error.
             )doc",
-            "other"_a, "op"_a)
-        .def("__sub__", &path_op<SkPathOp::kDifference_SkPathOp>, py::is_operator())
-        .def("__and__", &path_op<SkPathOp::kIntersect_SkPathOp>, py::is_operator())
-        .def("__or__", &path_op<SkPathOp::kUnion_SkPathOp>, py::is_operator())
-        .def("__xor__", &path_op<SkPathOp::kXOR_SkPathOp>, py::is_operator())
-        .def("__isub__", &path_iop<SkPathOp::kDifference_SkPathOp>, py::is_operator())
-        .def("__iand__", &path_iop<SkPathOp::kIntersect_SkPathOp>, py::is_operator())
-        .def("__ior__", &path_iop<SkPathOp::kUnion_SkPathOp>, py::is_operator())
-        .def("__ixor__", &path_iop<SkPathOp::kXOR_SkPathOp>, py::is_operator())
+            "other"_a, "op"_a, ReleaseGIL())
+        .def("__sub__", &path_op<SkPathOp::kDifference_SkPathOp>, py::is_operator(), ReleaseGIL())
+        .def("__and__", &path_op<SkPathOp::kIntersect_SkPathOp>, py::is_operator(), ReleaseGIL())
+        .def("__or__", &path_op<SkPathOp::kUnion_SkPathOp>, py::is_operator(), ReleaseGIL())
+        .def("__xor__", &path_op<SkPathOp::kXOR_SkPathOp>, py::is_operator(), ReleaseGIL())
+        .def("__isub__", &path_iop<SkPathOp::kDifference_SkPathOp>, py::is_operator(), ReleaseGIL())
+        .def("__iand__", &path_iop<SkPathOp::kIntersect_SkPathOp>, py::is_operator(), ReleaseGIL())
+        .def("__ior__", &path_iop<SkPathOp::kUnion_SkPathOp>, py::is_operator(), ReleaseGIL())
+        .def("__ixor__", &path_iop<SkPathOp::kXOR_SkPathOp>, py::is_operator(), ReleaseGIL())
         .def(
             "simplify",
             [](const SkPath &path)
@@ -630,7 +703,7 @@ void initPath(py::module &m)
             R"doc(
                 Return the path as a set of non-overlapping contours that describe the same area as the original path.
                 If the simplify fails, throws a runtime error.
-            )doc")
+            )doc", ReleaseGIL())
         .def(
             "isimplify",
             [](SkPath &self)
@@ -639,7 +712,8 @@ void initPath(py::module &m)
                     return self;
                 throw std::runtime_error("Failed to simplify path.");
             },
-            "Simplify the path in place and return itself. If the simplify fails, throws a runtime error.")
+            "Simplify the path in place and return itself. If the simplify fails, throws a runtime error.",
+            ReleaseGIL())
         .def(
             "tightBounds",
             [](const SkPath &path)
@@ -649,7 +723,7 @@ void initPath(py::module &m)
                     return result;
                 throw std::runtime_error("Failed to compute tight bounds.");
             },
-            "Return the resulting rectangle to the tight bounds of the path.")
+            "Return the resulting rectangle to the tight bounds of the path.", ReleaseGIL())
         .def(
             "asWinding",
             [](const SkPath &path)
@@ -662,7 +736,7 @@ void initPath(py::module &m)
             R"doc(
                 Return the result with fill type winding to area equivalent to path. If the conversion fails, throws
                 a runtime error.
-            )doc");
+            )doc", ReleaseGIL());
 
     py::class_<SkOpBuilder>(m, "OpBuilder")
         .def(py::init<>())
@@ -679,7 +753,7 @@ void initPath(py::module &m)
             R"doc(
                 Computes the sum of all paths and operands and returns it, and resets the builder to its initial state.
                 If the operation fails, throws a runtime error.
-            )doc");
+            )doc", ReleaseGIL());
 
     Path.def(
             "fillPathWithPaint",
@@ -687,7 +761,7 @@ void initPath(py::module &m)
             {
                 SkPath dst;
                 bool isFill = skpathutils::FillPathWithPaint(src, paint, &dst, cullRect, resScale);
-                return py::make_tuple(dst, isFill);
+                return std::make_tuple(dst, isFill);
             },
             R"doc(
                 Returns the filled equivalent of the stroked path.
@@ -700,16 +774,16 @@ void initPath(py::module &m)
                 :return: a tuple of (:py:class:`Path`, bool) where the bool indicates whether the path represents style
                     fill or hairline (true for fill, false for hairline)
             )doc",
-            "paint"_a, "cullRect"_a = nullptr, "resScale"_a = 1)
+            "paint"_a, "cullRect"_a = nullptr, "resScale"_a = 1, ReleaseGIL())
         .def(
             "fillPathWithPaint",
             [](const SkPath &src, const SkPaint &paint, const SkRect *cullRect, const SkMatrix &ctm)
             {
                 SkPath dst;
                 bool isFill = skpathutils::FillPathWithPaint(src, paint, &dst, cullRect, ctm);
-                return py::make_tuple(dst, isFill);
+                return std::make_tuple(dst, isFill);
             },
-            "Returns the filled equivalent of the stroked path.", "paint"_a, "cullRect"_a, "ctm"_a)
+            "Returns the filled equivalent of the stroked path.", "paint"_a, "cullRect"_a, "ctm"_a, ReleaseGIL())
         .def_static(
             "GetFromText",
             [](const std::string &text, const SkScalar &x, const SkScalar &y, const SkFont &font,
@@ -720,7 +794,7 @@ void initPath(py::module &m)
                 return path;
             },
             "Returns the path representing the *text* using SkTextUtils.", "text"_a, "x"_a, "y"_a, "font"_a,
-            "encoding"_a = SkTextEncoding::kUTF8);
+            "encoding"_a = SkTextEncoding::kUTF8, ReleaseGIL());
 
     py::class_<SkCubicMap>(m, "CubicMap")
         .def(py::init<SkPoint, SkPoint>(), "p1"_a, "p2"_a)
@@ -171,7 +171,7 @@ void initPathEffect(py::module &m)
                 Given a *src* path (input) and a stroke-*rec* (input and output), apply this effect to the *src* path,
                 returning the new path.
             )doc",
-            "src"_a, "rec"_a, "cullR"_a = skif::kNoCropRect, "ctm"_a = SkMatrix::I())
+            "src"_a, "rec"_a, "cullR"_a = skif::kNoCropRect, "ctm"_a = SkMatrix::I(), ReleaseGIL())
         .def("needsCTM", &SkPathEffect::needsCTM)
         .def_static(
             "Deserialize",
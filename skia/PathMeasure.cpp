@@ -1,16 +1,102 @@
 #include "common.h"
+#include "include/core/SkContourMeasure.h"
 #include "include/core/SkPathMeasure.h"
+#include <algorithm>
+
+// SkPathMeasure that remembers its path, so that sample() can measure all of its contours at once.
+class PyPathMeasure : public SkPathMeasure
+{
+public:
+    PyPathMeasure() = default;
+    PyPathMeasure(const SkPath &path, bool forceClosed, SkScalar resScale)
+        : SkPathMeasure(path, forceClosed, resScale), fPath(path), fForceClosed(forceClosed), fResScale(resScale)
+    {
+    }
+
+    // A null *path* resets the measure, like SkPathMeasure::setPath().
+    void setPath(const SkPath *path, bool forceClosed)
+    {
+        SkPathMeasure::setPath(path, forceClosed);
+        fPath = path ? *path : SkPath();
+        fForceClosed = forceClosed;
+        fResScale = 1;
+        fContours.clear();
+        fStarts.clear();
+    }
+
+    SkScalar totalLength()
+    {
+        measureContours();
+        return fStarts.empty() ? 0 : fStarts.back() + fContours.back()->length();
+    }
+
+    // Writes the position and tangent at each of the *count* distances along all contours. Distances are pinned to
+    // [0, totalLength()].
+    void sample(const SkScalar *distances, size_t count, SkPoint *positions, SkVector *tangents)
+    {
+        measureContours();
+        if (fContours.empty())
+            throw std::runtime_error("zero-length path in sample.");
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t index = std::max<ptrdiff_t>(
+                std::upper_bound(fStarts.begin(), fStarts.end(), distances[i]) - fStarts.begin() - 1, 0);
+            if (!fContours[index]->getPosTan(distances[i] - fStarts[index], positions + i, tangents + i))
+                throw std::runtime_error("Failed to get position and tangent.");
+        }
+    }
+
+private:
+    SkPath fPath;
+    bool fForceClosed = false;
+    SkScalar fResScale = 1;
+    std::vector<sk_sp<SkContourMeasure>> fContours;
+    std::vector<SkScalar> fStarts;
+
+    void measureContours()
+    {
+        if (!fContours.empty())
+            return;
+        SkContourMeasureIter iter(fPath, fForceClosed, fResScale);
+        SkScalar start = 0;
+        while (sk_sp<SkContourMeasure> contour = iter.next())
+        {
+            fStarts.push_back(start);
+            start += contour->length();
+            fContours.push_back(std::move(contour));
+        }
+    }
+};
+
+// Returns the positions and tangents, or the RSXforms, at *distances* as numpy arrays.
+py::object samplePathMeasure(PyPathMeasure &self, const SkScalar *distances, size_t count, bool rsxform)
+{
+    FloatArray positions({py::ssize_t(count), py::ssize_t(2)}), tangents({py::ssize_t(count), py::ssize_t(2)});
+    SkPoint *pos = reinterpret_cast<SkPoint *>(positions.mutable_data());
+    SkVector *tan = reinterpret_cast<SkVector *>(tangents.mutable_data());
+    {
+        py::gil_scoped_release release;
+        self.sample(distances, count, pos, tan);
+    }
+    if (!rsxform)
+        return py::make_tuple(positions, tangents);
+    FloatArray xforms({py::ssize_t(count), py::ssize_t(4)});
+    float *xform = xforms.mutable_data();
+    for (size_t i = 0; i < count; ++i, xform += 4)
+        xform[0] = tan[i].fX, xform[1] = tan[i].fY, xform[2] = pos[i].fX, xform[3] = pos[i].fY;
+    return std::move(xforms);
+}
 
 void initPathMeasure(py::module &m)
 {
-    py::class_<SkPathMeasure> PathMeasure(m, "PathMeasure");
+    py::class_<PyPathMeasure> PathMeasure(m, "PathMeasure");
     PathMeasure.def(py::init())
         .def(py::init<const SkPath &, bool, SkScalar>(), "path"_a, "forceClosed"_a = false, "resScale"_a = 1)
-        .def("setPath", &SkPathMeasure::setPath, "path"_a, "forceClosed"_a = false)
+        .def("setPath", &PyPathMeasure::setPath, "path"_a, "forceClosed"_a = false)
         .def("getLength", &SkPathMeasure::getLength)
         .def(
             "getPosTan",
-            [](SkPathMeasure &self, const SkScalar &distance)
+            [](PyPathMeasure &self, const SkScalar &distance)
             {
                 SkPoint position;
                 SkVector tangent;
@@ -28,7 +114,7 @@ void initPathMeasure(py::module &m)
     PathMeasure
         .def(
             "getMatrix",
-            [](SkPathMeasure &measure, const SkScalar &distance, const SkPathMeasure::MatrixFlags &flags)
+            [](PyPathMeasure &measure, const SkScalar &distance, const SkPathMeasure::MatrixFlags &flags)
             {
                 SkMatrix matrix;
                 if (measure.getMatrix(distance, &matrix, flags))
@@ -42,7 +128,7 @@ void initPathMeasure(py::module &m)
             "distance"_a, "flags"_a = SkPathMeasure::MatrixFlags::kGetPosAndTan_MatrixFlag)
         .def(
             "getSegment",
-            [](SkPathMeasure &self, const SkScalar &startD, const SkScalar &stopD, const bool &startWithMoveTo)
+            [](PyPathMeasure &self, const SkScalar &startD, const SkScalar &stopD, const bool &startWithMoveTo)
             {
                 SkPath dst;
                 if (self.getSegment(startD, stopD, &dst, startWithMoveTo))
@@ -50,7 +136,54 @@ void initPathMeasure(py::module &m)
                 return SkPath();
             },
             "Given a start and stop distance, return the intervening segment(s).", "startD"_a, "stopD"_a,
-            "startWithMoveTo"_a = true)
+            "startWithMoveTo"_a = true, ReleaseGIL())
         .def("isClosed", &SkPathMeasure::isClosed)
-        .def("nextContour", &SkPathMeasure::nextContour);
+        .def("nextContour", &SkPathMeasure::nextContour)
+        .def("getTotalLength", &PyPathMeasure::totalLength,
+             "Returns the length of all contours, unlike :py:meth:`getLength` which only measures the current one.",
+             ReleaseGIL())
+        .def(
+            "sample",
+            [](PyPathMeasure &self, size_t count, bool endpoint, bool rsxform)
+            {
+                const size_t intervals = endpoint && count > 1 ? count - 1 : std::max<size_t>(count, 1);
+                const SkScalar step = self.totalLength() / intervals;
+                std::vector<SkScalar> distances(count);
+                for (size_t i = 0; i < count; ++i)
+                    distances[i] = i * step;
+                return samplePathMeasure(self, distances.data(), count, rsxform);
+            },
+            R"doc(
+                Samples *count* positions and tangents evenly spaced along all contours of the path. Returns the same
+                as the overload taking *distances*.
+
+                :param count: The number of samples.
+                :param endpoint: Whether the last sample is at the end of the path. If ``False``, the samples are spaced
+                    by ``getTotalLength() / count``, which suits closed paths.
+                :param rsxform: Whether to return RSXforms instead of positions and tangents.
+            )doc",
+            "count"_a, "endpoint"_a = true, "rsxform"_a = false)
+        .def(
+            "sample",
+            [](PyPathMeasure &self, const py::array_t<SkScalar, py::array::c_style | py::array::forcecast> &distances,
+               bool rsxform)
+            {
+                const size_t count = ndarrayRows(distances, 1, "distances");
+                return samplePathMeasure(self, distances.data(), count, rsxform);
+            },
+            R"doc(
+                Samples the positions and tangents at all *distances* in a single call. Unlike :py:meth:`getPosTan`,
+                distances are measured along all contours of the path, one after another, and are pinned to
+                0 <= distance <= :py:meth:`getTotalLength`. The GIL is released while sampling.
+
+                If *rsxform* is ``True``, returns a float32 array of shape=(N, 4) of :py:class:`RSXform` that rotate to
+                the tangent and translate to the position, which can be passed directly to the array overloads of
+                :py:meth:`Canvas.drawAtlas`, :py:meth:`Canvas.drawGlyphs` and :py:meth:`TextBlob.MakeFromRSXform`.
+
+                :param distances: 1D array of distances.
+                :param rsxform: Whether to return RSXforms instead of positions and tangents.
+                :return: tuple of (positions, tangents), each a float32 array of shape=(N, 2), or an array of
+                    RSXforms.
+            )doc",
+            "distances"_a, "rsxform"_a = false);
 }
\ No newline at end of file
@@ -126,12 +126,13 @@ void initPixmap(py::module &m)
              "Copies *dstInfo* pixels starting from (*srcX*, *srcY*) to *dstPixels* buffer.", "dstInfo"_a,
              "dstPixels"_a, "dstRowBytes"_a = 0, "srcX"_a = 0, "srcY"_a = 0)
         .def("readPixels", py::overload_cast<const SkPixmap &, int, int>(&SkPixmap::readPixels, py::const_), "dst"_a,
-             "srcX"_a = 0, "srcY"_a = 0)
-        .def("scalePixels", &SkPixmap::scalePixels, "dst"_a, "sampling"_a)
-        .def("erase", py::overload_cast<SkColor, const SkIRect &>(&SkPixmap::erase, py::const_), "color"_a, "subset"_a)
-        .def("erase", py::overload_cast<SkColor>(&SkPixmap::erase, py::const_), "color"_a)
+             "srcX"_a = 0, "srcY"_a = 0, ReleaseGIL())
+        .def("scalePixels", &SkPixmap::scalePixels, "dst"_a, "sampling"_a, ReleaseGIL())
+        .def("erase", py::overload_cast<SkColor, const SkIRect &>(&SkPixmap::erase, py::const_), "color"_a, "subset"_a,
+             ReleaseGIL())
+        .def("erase", py::overload_cast<SkColor>(&SkPixmap::erase, py::const_), "color"_a, ReleaseGIL())
         .def("erase", py::overload_cast<const SkColor4f &, const SkIRect *>(&SkPixmap::erase, py::const_), "color"_a,
-             "subset"_a = nullptr)
+             "subset"_a = nullptr, ReleaseGIL())
         .def("__str__",
              [](const SkPixmap &self)
              {
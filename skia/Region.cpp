@@ -58,7 +58,7 @@ void initRegion(py::module &m)
             [](SkRegion &self, const std::vector<SkIRect> &rects) { return self.setRects(rects.data(), rects.size()); },
             "Constructs :py:class:`Region` as the union of :py:class:`IRect` in *rects* array.", "rects"_a)
         .def("setRegion", &SkRegion::setRegion, "region"_a)
-        .def("setPath", &SkRegion::setPath, "path"_a, "clip"_a)
+        .def("setPath", &SkRegion::setPath, "path"_a, "clip"_a, ReleaseGIL())
         .def("intersects", py::overload_cast<const SkIRect &>(&SkRegion::intersects, py::const_), "rect"_a)
         .def("intersects", py::overload_cast<const SkRegion &>(&SkRegion::intersects, py::const_), "other"_a)
         .def("contains", py::overload_cast<int32_t, int32_t>(&SkRegion::contains, py::const_), "x"_a, "y"_a)
@@ -76,7 +76,7 @@ void initSurface(py::module &m)
         .def("draw",
              py::overload_cast<SkCanvas *, SkScalar, SkScalar, const SkSamplingOptions &, const SkPaint *>(
                  &SkSurface::draw),
-             "canvas"_a, "x"_a, "y"_a, "sampling"_a = SkSamplingOptions(), "paint"_a = nullptr)
+             "canvas"_a, "x"_a, "y"_a, "sampling"_a = SkSamplingOptions(), "paint"_a = nullptr, ReleaseGIL())
         .def(
             "peekPixels",
             [](SkSurface &self)
@@ -88,16 +88,16 @@ void initSurface(py::module &m)
             },
             "Returns a :py:class:`Pixmap` describing the pixel data.")
         .def("readPixels", py::overload_cast<const SkPixmap &, int, int>(&SkSurface::readPixels), "dst"_a, "srcX"_a = 0,
-             "srcY"_a = 0)
+             "srcY"_a = 0, ReleaseGIL())
         .def("readPixels", &readPixels<SkSurface>,
              "Copies *dstInfo* pixels starting from (*srcX*, *srcY*) to *dstPixels* buffer.", "dstInfo"_a,
              "dstPixels"_a, "dstRowBytes"_a = 0, "srcX"_a = 0, "srcY"_a = 0)
         .def("readPixels", py::overload_cast<const SkBitmap &, int, int>(&SkSurface::readPixels), "dst"_a, "srcX"_a = 0,
-             "srcY"_a = 0)
+             "srcY"_a = 0, ReleaseGIL())
         .def("writePixels", py::overload_cast<const SkPixmap &, int, int>(&SkSurface::writePixels), "src"_a,
-             "dstX"_a = 0, "dstY"_a = 0)
+             "dstX"_a = 0, "dstY"_a = 0, ReleaseGIL())
         .def("writePixels", py::overload_cast<const SkBitmap &, int, int>(&SkSurface::writePixels), "src"_a,
-             "dstX"_a = 0, "dstY"_a = 0)
+             "dstX"_a = 0, "dstY"_a = 0, ReleaseGIL())
         .def("props", &SkSurface::props)
         .def(
             "__enter__", [](SkSurface &self) { return self.getCanvas(); },
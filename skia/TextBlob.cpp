@@ -73,6 +73,21 @@ void initTextBlob(py::module &m)
             },
             "Returns a :py:class:`TextBlob` built from a single run of *text* with *pos*.", "text"_a, "pos"_a, "font"_a,
             "encoding"_a = SkTextEncoding::kUTF8)
+        .def_static(
+            "MakeFromRSXform",
+            [](const std::string &text, const FloatArray &xform, const SkFont &font, const SkTextEncoding &encoding)
+            {
+                const size_t byteLength = text.size();
+                if (ndarrayRows(xform, 4, "xform") != size_t(font.countText(text.c_str(), byteLength, encoding)))
+                    throw py::value_error("text and xform must be the same length.");
+                return SkTextBlob::MakeFromRSXform(text.c_str(), byteLength,
+                                                   reinterpret_cast<const SkRSXform *>(xform.data()), font, encoding);
+            },
+            R"doc(
+                Returns a :py:class:`TextBlob` built from a single run of *text* with *xform*, a float32 array of shape
+                (N, 4) with one :py:class:`RSXform` per glyph, like the one returned by :py:meth:`PathMeasure.sample`.
+            )doc",
+            "text"_a, "xform"_a.noconvert(), "font"_a, "encoding"_a = SkTextEncoding::kUTF8)
         .def_static(
             "MakeFromRSXform",
             [](const std::string &text, const std::vector<SkRSXform> &xform, const SkFont &font,
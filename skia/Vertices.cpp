@@ -1,5 +1,7 @@
 #include "common.h"
 #include "include/core/SkVertices.h"
+#include <algorithm>
+#include <climits>
 #include <pybind11/stl.h>
 
 sk_sp<SkVertices> Vertices_MakeCopy(const SkVertices::VertexMode &mode, const std::vector<SkPoint> &positions,
@@ -19,6 +21,43 @@ sk_sp<SkVertices> Vertices_MakeCopy(const SkVertices::VertexMode &mode, const st
                                 colors ? colors->data() : nullptr);
 }
 
+sk_sp<SkVertices> Vertices_MakeCopyArrays(const SkVertices::VertexMode &mode, const FloatArray &positions,
+                                          const std::optional<FloatArray> &texs,
+                                          const std::optional<ColorArray> &colors,
+                                          const std::optional<IndexArray> &indices, const SkPoint &offset)
+{
+    const size_t vertexCount = ndarrayRows(positions, 2, "positions");
+    if ((texs && ndarrayRows(*texs, 2, "texs") != vertexCount) ||
+        (colors && ndarrayRows(*colors, 1, "colors") != vertexCount))
+        throw py::value_error("positions, texs, and colors must be the same length.");
+    const size_t indexCount = indices ? ndarrayRows(*indices, 1, "indices") : 0;
+    if (vertexCount > INT_MAX || indexCount > INT_MAX)
+        throw py::value_error("Too many vertices or indices.");
+    const SkPoint *src = reinterpret_cast<const SkPoint *>(positions.data());
+    const SkPoint *srcTexs = texs ? reinterpret_cast<const SkPoint *>(texs->data()) : nullptr;
+    const SkColor *srcColors = colors ? colors->data() : nullptr;
+    const uint16_t *srcIndices = indices ? indices->data() : nullptr;
+    if (srcIndices && std::any_of(srcIndices, srcIndices + indexCount, [=](uint16_t i) { return i >= vertexCount; }))
+        throw py::value_error("indices must be less than the number of vertices.");
+
+    py::gil_scoped_release release;
+    SkVertices::Builder builder(mode, vertexCount, indexCount,
+                                (texs ? SkVertices::kHasTexCoords_BuilderFlag : 0) |
+                                    (colors ? SkVertices::kHasColors_BuilderFlag : 0));
+    if (!builder.isValid()) // the buffers could not be allocated
+        throw std::bad_alloc();
+    SkPoint *dst = builder.positions();
+    for (size_t i = 0; i < vertexCount; ++i)
+        dst[i] = src[i] + offset;
+    if (srcTexs)
+        std::copy_n(srcTexs, vertexCount, builder.texCoords());
+    if (srcColors)
+        std::copy_n(srcColors, vertexCount, builder.colors());
+    if (srcIndices)
+        std::copy_n(srcIndices, indexCount, builder.indices());
+    return builder.detach();
+}
+
 void initVertices(py::module &m)
 {
     py::class_<SkVertices, sk_sp<SkVertices>> Vertices(m, "Vertices");
@@ -30,8 +69,26 @@ void initVertices(py::module &m)
         .value("kLast_VertexMode", SkVertices::VertexMode::kLast_VertexMode);
 
     Vertices
+        .def(py::init(&Vertices_MakeCopyArrays),
+             R"doc(
+                Create a vertices by copying numpy arrays, without creating any :py:class:`Point` or
+                :py:class:`Color4f`. The GIL is released while copying.
+
+                :param mode: The vertex mode.
+                :param positions: float32 numpy array of shape=(N, 2).
+                :param texs: float32 numpy array of shape=(N, 2), or ``None``.
+                :param colors: uint32 numpy array of shape=(N,) of ARGB colors, or ``None``.
+                :param indices: uint16 numpy array of shape=(M,) of indices less than N, or ``None``.
+                :param offset: Added to every position while copying.
+            )doc",
+             "mode"_a, "positions"_a.noconvert(), "texs"_a.noconvert() = py::none(),
+             "colors"_a.noconvert() = py::none(), "indices"_a.noconvert() = py::none(), "offset"_a = SkPoint{0, 0})
         .def(py::init(&Vertices_MakeCopy), "Create a vertices by copying the specified arrays.", "mode"_a,
              "positions"_a, "texs"_a = py::none(), "colors"_a = py::none(), "indices"_a = py::none())
+        .def_static("MakeCopy", &Vertices_MakeCopyArrays,
+                    "Create a vertices by copying numpy arrays. See :py:meth:`__init__` for the array shapes.",
+                    "mode"_a, "positions"_a.noconvert(), "texs"_a.noconvert(), "colors"_a.noconvert(),
+                    "indices"_a.noconvert() = py::none(), "offset"_a = SkPoint{0, 0})
         .def_static("MakeCopy", &Vertices_MakeCopy, "Create a vertices by copying the specified arrays.", "mode"_a,
                     "positions"_a, "texs"_a, "colors"_a, "indices"_a = py::none())
         .def("uniqueID", &SkVertices::uniqueID)
@@ -650,8 +650,16 @@ void initCms(py::module &m)
                auto strides = src.strides();
                py::array dst(src.dtype(), std::vector<py::ssize_t>(shape, shape + ndim),
                              std::vector<py::ssize_t>(strides, strides + ndim));
-               if (skcms_Transform(src.data(), srcFmt, srcAlpha, srcProfile, dst.mutable_data(), dstFmt, dstAlpha,
-                                   dstProfile, src.size()))
+               const void *srcData = src.data();
+               void *dstData = dst.mutable_data();
+               const size_t npixels = src.size();
+               bool success;
+               {
+                   py::gil_scoped_release release;
+                   success = skcms_Transform(srcData, srcFmt, srcAlpha, srcProfile, dstData, dstFmt, dstAlpha,
+                                             dstProfile, npixels);
+               }
+               if (success)
                    return dst;
                throw py::value_error("Failed to transform.");
            },
@@ -681,8 +689,16 @@ void initCms(py::module &m)
                 auto strides = src.strides();
                 py::array dst(src.dtype(), std::vector<py::ssize_t>(shape, shape + ndim),
                               std::vector<py::ssize_t>(strides, strides + ndim));
-                if (skcms_TransformWithPalette(src.data(), srcFmt, srcAlpha, srcProfile, dst.mutable_data(), dstFmt,
-                                               dstAlpha, dstProfile, src.size(), palette ? palette->data() : nullptr))
+                const void *srcData = src.data(), *paletteData = palette ? palette->data() : nullptr;
+                void *dstData = dst.mutable_data();
+                const size_t npixels = src.size();
+                bool success;
+                {
+                    py::gil_scoped_release release;
+                    success = skcms_TransformWithPalette(srcData, srcFmt, srcAlpha, srcProfile, dstData, dstFmt,
+                                                         dstAlpha, dstProfile, npixels, paletteData);
+                }
+                if (success)
                     return dst;
                 throw py::value_error("Failed to transform.");
             },
@@ -710,8 +726,16 @@ void initCms(py::module &m)
                const skcms_AlphaFormat &dstAlpha, const skcms_ICCProfile *dstProfile,
                const std::optional<py::array> &palette)
             {
-                if (skcms_TransformWithPalette(src.data(), srcFmt, srcAlpha, srcProfile, dst.mutable_data(), dstFmt,
-                                               dstAlpha, dstProfile, src.size(), palette ? palette->data() : nullptr))
+                const void *srcData = src.data(), *paletteData = palette ? palette->data() : nullptr;
+                void *dstData = dst.mutable_data();
+                const size_t npixels = src.size();
+                bool success;
+                {
+                    py::gil_scoped_release release;
+                    success = skcms_TransformWithPalette(srcData, srcFmt, srcAlpha, srcProfile, dstData, dstFmt,
+                                                         dstAlpha, dstProfile, npixels, paletteData);
+                }
+                if (success)
                     return dst;
                 throw py::value_error("Failed to transform.");
             },
@@ -1,36 +1,62 @@
 #ifndef _COMMON_H_
 #define _COMMON_H_
 
+#include "include/core/SkEncodedImageFormat.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkString.h"
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+class SkData;
+class SkImage;
+
 using namespace pybind11::literals;
 namespace py = pybind11;
 
 PYBIND11_DECLARE_HOLDER_TYPE(T, sk_sp<T>);
 
+// Call guard that releases the GIL while the bound function runs. Use it on bindings that do heavy work and whose
+// arguments are all converted to C++ types, i.e., bindings that do not touch any Python object in their body. Bindings
+// that take a buffer should instead release the GIL themselves after requesting the buffer.
+using ReleaseGIL = py::call_guard<py::gil_scoped_release>;
+
+// C-contiguous arrays whose data can be passed to Skia without copying. Overloads taking them should mark the argument
+// with .noconvert() and be registered before the ones taking lists, so that other arrays fall through to the lists.
+using FloatArray = py::array_t<float, py::array::c_style>;
+using ColorArray = py::array_t<uint32_t, py::array::c_style>;
+using GlyphArray = py::array_t<uint16_t, py::array::c_style>;
+using IndexArray = py::array_t<uint16_t, py::array::c_style>;
+
 SkImageInfo ndarrayToImageInfo(const py::array &array, const SkColorType &ct, const SkAlphaType &at,
                                const sk_sp<SkColorSpace> &cs);
+size_t ndarrayRows(const py::array &array, py::ssize_t columns, const char *name);
 size_t validateImageInfo_Buffer(const SkImageInfo &imgInfo, const py::buffer_info &bufInfo, size_t rowBytes);
 py::buffer_info imageInfoToBufferInfo(const SkImageInfo &imgInfo, void *data, py::ssize_t rowBytes, bool readonly);
+sk_sp<SkData> encodeToData(const SkImage *self, const SkEncodedImageFormat &format = SkEncodedImageFormat::kPNG,
+                           const int &quality = 100);
 
 template <typename T>
 bool readPixels(T &readable, const SkImageInfo &imgInfo, const py::buffer &dstPixels, size_t dstRowBytes, int srcX,
                 int srcY)
 {
     const py::buffer_info bufInfo = dstPixels.request();
-    return readable.readPixels(imgInfo, bufInfo.ptr, validateImageInfo_Buffer(imgInfo, bufInfo, dstRowBytes), srcX,
-                               srcY);
+    const size_t rowBytes = validateImageInfo_Buffer(imgInfo, bufInfo, dstRowBytes);
+    py::gil_scoped_release release;
+    return readable.readPixels(imgInfo, bufInfo.ptr, rowBytes, srcX, srcY);
 }
 template <typename T>
 py::array readToNumpy(T &readable, int srcX, int srcY, SkColorType ct, SkAlphaType at, const sk_sp<SkColorSpace> &cs)
 {
     SkImageInfo imgInfo = SkImageInfo::Make(readable.imageInfo().dimensions(), ct, at, cs);
     py::array array(imageInfoToBufferInfo(imgInfo, nullptr, 0, false));
-    if (readable.readPixels(imgInfo, array.mutable_data(), imgInfo.minRowBytes(), srcX, srcY))
+    void *pixels = array.mutable_data();
+    bool success;
+    {
+        py::gil_scoped_release release;
+        success = readable.readPixels(imgInfo, pixels, imgInfo.minRowBytes(), srcX, srcY);
+    }
+    if (success)
         return array;
     throw py::value_error("Failed to read pixels.");
 }
@@ -46,26 +72,33 @@ void initColor(py::module &);
 void initColorFilter(py::module &);
 void initColorSpace(py::module &);
 void initDartTypes(py::module &);
+void initEasing(py::module &);
 void initData(py::module &);
 void initExtras(py::module &);
 void initFlattenable(py::module &);
 void initFont(py::module &);
+void initFrameRing(py::module &);
 void initImage(py::module &);
+void initImageSequenceWriter(py::module &);
 void initImageFilter(py::module &);
 void initImageInfo(py::module &);
 void initMaskFilter(py::module &);
 void initMatrix(py::module &);
+void initNoise(py::module &);
 void initPaint(py::module &);
 void initParagraph(py::module &);
 void initParagraphStyle(py::module &);
+void initParticleSystem(py::module &);
 void initPath(py::module &);
 void initPathEffect(py::module &);
 void initPathMeasure(py::module &);
+void initPathMorph(py::module &);
 void initPicture(py::module &);
 void initPixmap(py::module &);
 void initPoint(py::module &);
 void initRect(py::module &);
 void initRegion(py::module &);
+void initRender(py::module &);
 void initRuntimeEffect(py::module &);
 void initSize(py::module &);
 void initShader(py::module &);
@@ -75,6 +108,7 @@ void initSvg(py::module &);
 void initTextBlob(py::module &);
 void initTextlayout(py::module &);
 void initTextStyle(py::module &);
+void initTimeline(py::module &);
 void initUniqueColor(py::module &);
 void initVertices(py::module &);
 // void initSVGDOM(py::module &);
@@ -3,4 +3,12 @@
 void initExtras(py::module &m)
 {
     initUniqueColor(m);
+    initRender(m);
+    initImageSequenceWriter(m);
+    initParticleSystem(m);
+    initPathMorph(m);
+    initEasing(m);
+    initTimeline(m);
+    initNoise(m);
+    initFrameRing(m);
 }
\ No newline at end of file
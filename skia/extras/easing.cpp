@@ -0,0 +1,87 @@
+#include "common.h"
+#include "extras/easing.h"
+
+void initEasing(py::module &m)
+{
+    py::class_<Easing> easing(m, "Easing", R"doc(
+        A native easing function, which can be called with a single float, or with a numpy array to ease many values
+        in a single call. The curves are the same as those in :py:mod:`animator.anim.easing`.
+    )doc");
+
+    py::enum_<Easing::Type>(easing, "Type")
+        .value("kLinear", Easing::Type::kLinear)
+        .value("kSinIn", Easing::Type::kSinIn)
+        .value("kSinOut", Easing::Type::kSinOut)
+        .value("kSinInOut", Easing::Type::kSinInOut)
+        .value("kCircIn", Easing::Type::kCircIn)
+        .value("kCircOut", Easing::Type::kCircOut)
+        .value("kCircInOut", Easing::Type::kCircInOut)
+        .value("kExpIn", Easing::Type::kExpIn)
+        .value("kExpOut", Easing::Type::kExpOut)
+        .value("kExpInOut", Easing::Type::kExpInOut)
+        .value("kBounceIn", Easing::Type::kBounceIn)
+        .value("kBounceOut", Easing::Type::kBounceOut)
+        .value("kBounceInOut", Easing::Type::kBounceInOut)
+        .value("kPowIn", Easing::Type::kPowIn)
+        .value("kPowOut", Easing::Type::kPowOut)
+        .value("kPowInOut", Easing::Type::kPowInOut)
+        .value("kBackIn", Easing::Type::kBackIn)
+        .value("kBackOut", Easing::Type::kBackOut)
+        .value("kBackInOut", Easing::Type::kBackInOut)
+        .value("kElasticIn", Easing::Type::kElasticIn)
+        .value("kElasticOut", Easing::Type::kElasticOut)
+        .value("kElasticInOut", Easing::Type::kElasticInOut)
+        .value("kQuadish", Easing::Type::kQuadish)
+        .value("kBezier", Easing::Type::kBezier);
+
+    easing
+        .def(py::init<Easing::Type, float, float>(),
+             R"doc(
+                :param type: The curve.
+                :param a: The power for ``kPow*``, the overshoot for ``kBack*``, the amplitude for ``kElastic*`` and the
+                    amount for ``kQuadish``. Ignored by other curves.
+                :param b: The period for ``kElastic*``. Ignored by other curves.
+            )doc",
+             "type"_a, "a"_a = 0, "b"_a = 0)
+        .def_static("Bezier", &Easing::Bezier,
+                    R"doc(
+                        Creates a cubic bezier easing from (0, 0) to (1, 1) with control points (*x1*, *y1*) and (*x2*,
+                        *y2*), like the CSS ``cubic-bezier()`` timing function. The curve is sampled into a table once,
+                        so each evaluation only needs a few Newton iterations.
+                    )doc",
+                    "x1"_a, "y1"_a, "x2"_a, "y2"_a)
+        .def("type", &Easing::type)
+        .def(
+            "__call__",
+            [](const Easing &self, const py::object &t, std::optional<FloatArray> &out) -> py::object
+            {
+                if (!out && (py::isinstance<py::float_>(t) || py::isinstance<py::int_>(t)))
+                    return py::float_(self(t.cast<float>()));
+                const auto array = py::array_t<float, py::array::c_style | py::array::forcecast>::ensure(t);
+                if (!array)
+                    throw py::error_already_set();
+                if (!out && array.ndim() == 0) // numpy scalars and 0-d arrays
+                    return py::float_(self(*array.data()));
+                if (!out)
+                    out = FloatArray(std::vector<py::ssize_t>(array.shape(), array.shape() + array.ndim()));
+                else if (out->size() != array.size())
+                    throw py::value_error("out must have the same size as t.");
+                const float *in = array.data();
+                float *dst = out->mutable_data();
+                const size_t count = array.size();
+                {
+                    py::gil_scoped_release release;
+                    self.apply(in, dst, count);
+                }
+                return std::move(*out);
+            },
+            R"doc(
+                Eases *t*. If *t* is a scalar, including a numpy scalar or a 0-d array, returns a float. Otherwise,
+                eases every value of *t*, an array of any shape, and returns the result as a float32 array. The GIL is
+                released while evaluating arrays.
+
+                :param t: The value or values to ease.
+                :param out: A float32 array with the same size as *t* to store the result in. It can be *t* itself.
+            )doc",
+            "t"_a, "out"_a.noconvert() = py::none());
+}
@@ -0,0 +1,205 @@
+#ifndef _EASING_H_
+#define _EASING_H_
+
+#include "common.h"
+#include <cmath>
+
+// The formula of each curve in terms of *t*. These match the Python functions in animator/anim/easing.py.
+#define EASING_CASES(t)                                                                                                \
+    EASING_CASE(kLinear, t)                                                                                            \
+    EASING_CASE(kSinIn, 1 - std::cos(t * SK_FloatPI / 2))                                                              \
+    EASING_CASE(kSinOut, std::sin(t * SK_FloatPI / 2))                                                                 \
+    EASING_CASE(kSinInOut, (1 - std::cos(t * SK_FloatPI)) * 0.5f)                                                      \
+    EASING_CASE(kCircIn, 1 - std::sqrt(1 - t * t))                                                                     \
+    EASING_CASE(kCircOut, std::sqrt(t * (2 - t)))                                                                      \
+    EASING_CASE(kCircInOut, t < 0.5f ? (1 - std::sqrt(1 - 4 * t * t)) * 0.5f                                           \
+                                     : (1 + std::sqrt(1 - (2 * t - 2) * (2 * t - 2))) * 0.5f)                          \
+    EASING_CASE(kExpIn, std::exp2(10 * (t - 1)))                                                                       \
+    EASING_CASE(kExpOut, 1 - std::exp2(-10 * t))                                                                       \
+    EASING_CASE(kExpInOut, t < 0.5f ? std::exp2(20 * t - 11) : 1 - std::exp2(9 - 20 * t))                              \
+    EASING_CASE(kBounceIn, 1 - bounceOut(1 - t))                                                                       \
+    EASING_CASE(kBounceOut, bounceOut(t))                                                                              \
+    EASING_CASE(kBounceInOut, t < 0.5f ? (1 - bounceOut(1 - 2 * t)) * 0.5f : (1 + bounceOut(2 * t - 1)) * 0.5f)        \
+    EASING_CASE(kPowIn, std::pow(t, fA))                                                                               \
+    EASING_CASE(kPowOut, 1 - std::pow(1 - t, fA))                                                                      \
+    EASING_CASE(kPowInOut, t < 0.5f ? std::pow(2 * t, fA) * 0.5f : 1 - std::abs(std::pow(2 - 2 * t, fA)) * 0.5f)       \
+    EASING_CASE(kBackIn, t * t * ((fA + 1) * t - fA))                                                                  \
+    EASING_CASE(kBackOut, (t - 1) * (t - 1) * ((fA + 1) * (t - 1) + fA) + 1)                                           \
+    EASING_CASE(kBackInOut, t < 0.5f ? 4 * t * t * ((fA + 1) * 2 * t - fA) * 0.5f                                      \
+                                     : (2 * t - 2) * (2 * t - 2) * ((fA + 1) * (2 * t - 2) + fA) * 0.5f + 1)           \
+    EASING_CASE(kElasticIn, t == 0 || t == 1 ? t : -std::exp2(10 * (t - 1)) * wave(t - 1))                             \
+    EASING_CASE(kElasticOut, t == 0 || t == 1 ? t : std::exp2(-10 * t) * wave(t) + 1)                                  \
+    EASING_CASE(kElasticInOut, t < 0.5f ? -0.5f * std::exp2(20 * t - 10) * wave(2 * t - 1)                             \
+                                        : 0.5f * std::exp2(10 - 20 * t) * wave(2 * t - 1) + 1)                         \
+    EASING_CASE(kQuadish, t * (1 + (1 - t) * fA))                                                                      \
+    EASING_CASE(kBezier, bezierY(bezierT(t)))
+
+// An easing function that is evaluated natively, one value at a time or over whole arrays. Cubic bezier curves are
+// solved with a precomputed table of x values, refined with Newton's method or bisection.
+class Easing
+{
+public:
+    enum class Type
+    {
+        kLinear,
+        kSinIn,
+        kSinOut,
+        kSinInOut,
+        kCircIn,
+        kCircOut,
+        kCircInOut,
+        kExpIn,
+        kExpOut,
+        kExpInOut,
+        kBounceIn,
+        kBounceOut,
+        kBounceInOut,
+        kPowIn,
+        kPowOut,
+        kPowInOut,
+        kBackIn,
+        kBackOut,
+        kBackInOut,
+        kElasticIn,
+        kElasticOut,
+        kElasticInOut,
+        kQuadish,
+        kBezier,
+    };
+
+    Easing(Type type, float a, float b) : fType(type), fA(a), fB(b)
+    {
+        switch (type)
+        {
+        case Type::kElasticIn:
+        case Type::kElasticOut:
+        case Type::kElasticInOut:
+            if (std::abs(a) < 1)
+                throw py::value_error("amplitude must be at least 1.");
+            if (b == 0)
+                throw py::value_error("period must not be 0.");
+            fAsin = std::asin(1 / a);
+            fB = 2 * SK_FloatPI / b;
+            break;
+        case Type::kQuadish:
+            fA = SkTPin(a, -1.0f, 1.0f);
+            break;
+        case Type::kBezier:
+            throw py::value_error("Use Easing.Bezier() to create a bezier easing.");
+        default:
+            break;
+        }
+    }
+
+    static Easing Bezier(float x1, float y1, float x2, float y2)
+    {
+        if (x1 < 0 || x1 > 1 || x2 < 0 || x2 > 1)
+            throw py::value_error("x1 and x2 must be in [0, 1].");
+        Easing easing(Type::kLinear, 0, 0);
+        if (x1 == y1 && x2 == y2)
+            return easing;
+        easing.fType = Type::kBezier;
+        easing.fAx = 1 + 3 * x1 - 3 * x2, easing.fBx = 3 * x2 - 6 * x1, easing.fCx = 3 * x1;
+        easing.fAy = 1 + 3 * y1 - 3 * y2, easing.fBy = 3 * y2 - 6 * y1, easing.fCy = 3 * y1;
+        for (int i = 0; i < kSampleCount; ++i)
+            easing.fSamples[i] = easing.bezierX(i * kSampleStep);
+        return easing;
+    }
+
+    float operator()(float t) const
+    {
+        switch (fType)
+        {
+#define EASING_CASE(type, expression)                                                                                  \
+    case Type::type:                                                                                                   \
+        return expression;
+            EASING_CASES(t)
+#undef EASING_CASE
+        }
+        return t;
+    }
+
+    // Evaluates the easing for *count* values. The switch is outside the loop, so that each loop only contains the
+    // curve's formula and can be vectorized by the compiler.
+    void apply(const float *in, float *out, size_t count) const
+    {
+        switch (fType)
+        {
+#define EASING_CASE(type, expression)                                                                                  \
+    case Type::type:                                                                                                   \
+        for (size_t i = 0; i < count; ++i)                                                                             \
+        {                                                                                                              \
+            const float t = in[i];                                                                                     \
+            out[i] = expression;                                                                                       \
+        }                                                                                                              \
+        break;
+            EASING_CASES(t)
+#undef EASING_CASE
+        }
+    }
+
+    Type type() const { return fType; }
+
+private:
+    static constexpr int kSampleCount = 11;
+    static constexpr float kSampleStep = 1.0f / (kSampleCount - 1);
+
+    Type fType;
+    float fA, fB, fAsin = 0;
+    float fAx = 0, fBx = 0, fCx = 0, fAy = 0, fBy = 0, fCy = 0;
+    float fSamples[kSampleCount] = {};
+
+    float bezierX(float t) const { return ((fAx * t + fBx) * t + fCx) * t; }
+    float bezierY(float t) const { return ((fAy * t + fBy) * t + fCy) * t; }
+    float bezierSlopeX(float t) const { return (3 * fAx * t + 2 * fBx) * t + fCx; }
+
+    // Returns the parameter of the curve at which its x is *x*.
+    float bezierT(float x) const
+    {
+        x = SkTPin(x, 0.0f, 1.0f);
+        int i = 1;
+        while (i < kSampleCount - 1 && fSamples[i] <= x)
+            ++i;
+        --i;
+        float t = (i + (x - fSamples[i]) / (fSamples[i + 1] - fSamples[i])) * kSampleStep;
+
+        const float slope = bezierSlopeX(t);
+        if (slope >= 1e-3f)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                const float s = bezierSlopeX(t);
+                if (s == 0)
+                    break;
+                t -= (bezierX(t) - x) / s;
+            }
+            return t;
+        }
+        if (slope == 0)
+            return t;
+        float lo = i * kSampleStep, hi = lo + kSampleStep;
+        for (int k = 0; k < 10; ++k)
+        {
+            t = (lo + hi) * 0.5f;
+            const float error = bezierX(t) - x;
+            if (std::abs(error) < 1e-7f)
+                break;
+            (error > 0 ? hi : lo) = t;
+        }
+        return t;
+    }
+
+    static float bounceOut(float t)
+    {
+        if (t < 1 / 2.75f)
+            return 7.5625f * t * t;
+        if (t < 2 / 2.75f)
+            return 7.5625f * (t - 1.5f / 2.75f) * (t - 1.5f / 2.75f) + 0.75f;
+        if (t < 2.5f / 2.75f)
+            return 7.5625f * (t - 2.25f / 2.75f) * (t - 2.25f / 2.75f) + 0.9375f;
+        return 7.5625f * (t - 2.625f / 2.75f) * (t - 2.625f / 2.75f) + 0.984375f;
+    }
+    float wave(float t) const { return fA * std::sin(t * fB - fAsin); }
+};
+
+#endif
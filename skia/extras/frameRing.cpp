@@ -0,0 +1,129 @@
+#include "common.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Hands out the slots of a ring of *count* frame buffers between one producer (which renders frames) and one consumer
+// (which displays or encodes them), without locks. The producer writes slot (written % count) and publishes it, and
+// the consumer reads and releases slots in the same order. The producer only waits while every slot holds a frame the
+// consumer has not released. The buffers themselves are owned by the caller; the ring only passes slot indices.
+class FrameRing
+{
+public:
+    explicit FrameRing(int count) : fCount(count)
+    {
+        if (count < 1)
+            throw py::value_error("count must be at least 1.");
+    }
+
+    // Waits for a free slot and returns it, or -1 if the ring was closed.
+    int beginWrite()
+    {
+        const uint64_t written = fWritten.load(std::memory_order_relaxed);
+        if (!wait([&] { return written - fReleased.load(std::memory_order_acquire) < fCount; }))
+            return -1;
+        return static_cast<int>(written % fCount);
+    }
+
+    // Publishes the slot returned by the last beginWrite().
+    void endWrite() { fWritten.fetch_add(1, std::memory_order_release); }
+
+    // Waits for a published frame and returns its slot, or -1 if the ring was closed and every frame was consumed. If
+    // *latest*, all but the newest published frame are dropped.
+    int acquire(bool latest)
+    {
+        uint64_t released = fReleased.load(std::memory_order_relaxed);
+        if (!wait([&] { return fWritten.load(std::memory_order_acquire) > released; }, true))
+            return -1;
+        if (latest)
+        {
+            const uint64_t newest = fWritten.load(std::memory_order_acquire) - 1;
+            fDropped.fetch_add(newest - released, std::memory_order_relaxed);
+            fReleased.store(released = newest, std::memory_order_release);
+        }
+        return static_cast<int>(released % fCount);
+    }
+
+    // Returns the slot returned by the last acquire() to the producer.
+    void release() { fReleased.fetch_add(1, std::memory_order_release); }
+
+    // Wakes up both sides. The consumer can still acquire the frames that were published before.
+    void close() { fClosed.store(true, std::memory_order_release); }
+
+    int count() const { return static_cast<int>(fCount); }
+    bool closed() const { return fClosed.load(std::memory_order_acquire); }
+    // The number of published frames that were not released yet.
+    size_t pending() const
+    {
+        return fWritten.load(std::memory_order_acquire) - fReleased.load(std::memory_order_acquire);
+    }
+    size_t dropped() const { return fDropped.load(std::memory_order_relaxed); }
+
+private:
+    const uint64_t fCount;
+    // Each counter is written by one side only.
+    alignas(64) std::atomic<uint64_t> fWritten{0};
+    alignas(64) std::atomic<uint64_t> fReleased{0};
+    alignas(64) std::atomic<uint64_t> fDropped{0};
+    std::atomic<bool> fClosed{false};
+
+    // Spins, then yields, then sleeps until *ready* or the ring is closed. Returns whether *ready*. If *drain*, a
+    // closed ring still returns ready as long as *ready* holds.
+    template <typename F>
+    bool wait(F &&ready, bool drain = false)
+    {
+        for (int i = 0;; ++i)
+        {
+            if (ready())
+                return !closed() || drain;
+            if (closed())
+                return drain && ready();
+            if (i < 64)
+                continue;
+            if (i < 128)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+};
+
+void initFrameRing(py::module &m)
+{
+    py::class_<FrameRing>(m, "FrameRing", R"doc(
+        A lock-free single-producer, single-consumer handoff of the slots of a ring of frame buffers, so that one thread
+        can render the next frames while another displays or encodes the current one. The buffers are owned by the
+        caller and indexed by the returned slots; a slot is never handed to both sides at the same time.
+
+        The producer calls :py:meth:`beginWrite`, renders into the returned slot and calls :py:meth:`endWrite`. The
+        consumer calls :py:meth:`acquire`, reads the returned slot and calls :py:meth:`release`. Waiting methods
+        release the GIL, and return ``-1`` once the ring is closed with :py:meth:`close`.
+    )doc")
+        .def(py::init<int>(), ":param count: The number of buffers, at least 1.", "count"_a = 2)
+        .def("beginWrite", &FrameRing::beginWrite,
+             R"doc(
+                Waits until a slot is free, that is, until fewer than :py:meth:`count` frames are published but not
+                released, and returns it. Returns ``-1`` if the ring is closed. Must only be called by the producer.
+            )doc",
+             ReleaseGIL())
+        .def("endWrite", &FrameRing::endWrite, "Publishes the slot returned by the last :py:meth:`beginWrite`.")
+        .def("acquire", &FrameRing::acquire,
+             R"doc(
+                Waits until a frame is published and returns its slot. Frames are returned in the order they were
+                published. Returns ``-1`` if the ring is closed and no published frame is left. Must only be called by
+                the consumer.
+
+                :param latest: If ``True``, all frames but the newest published one are dropped, which keeps a slow
+                    consumer, like a display, from falling behind the producer. Dropped frames are counted by
+                    :py:meth:`dropped`.
+            )doc",
+             "latest"_a = false, ReleaseGIL())
+        .def("release", &FrameRing::release,
+             "Returns the slot returned by the last :py:meth:`acquire` to the producer.")
+        .def("close", &FrameRing::close,
+             "Closes the ring, which wakes up both sides. Frames published before can still be acquired.")
+        .def("count", &FrameRing::count, "Returns the number of buffers.")
+        .def("closed", &FrameRing::closed, "Returns whether the ring is closed.")
+        .def("pending", &FrameRing::pending, "Returns the number of published frames that are not released yet.")
+        .def("dropped", &FrameRing::dropped, "Returns the number of frames dropped by :py:meth:`acquire`.");
+}
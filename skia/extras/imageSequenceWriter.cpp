@@ -0,0 +1,249 @@
+#include "common.h"
+#include "extras/parallel.h"
+#include "include/core/SkColorSpace.h"
+#include "include/core/SkData.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkStream.h"
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <string>
+
+// Encodes and writes images to files on a pool of background threads. Images are queued by write(), which blocks while
+// the queue is full. Buffers used to snapshot numpy arrays are recycled once their image has been written.
+class ImageSequenceWriter
+{
+public:
+    ImageSequenceWriter(const SkEncodedImageFormat &format, const int &quality, int workers, int maxPending)
+        : fFormat(format), fQuality(quality)
+    {
+        workers = resolveWorkers(workers, SIZE_MAX);
+        fMaxPending = maxPending > 0 ? maxPending : 2 * workers;
+        fThreads.reserve(workers);
+        for (int i = 0; i < workers; ++i)
+            fThreads.emplace_back(&ImageSequenceWriter::run, this);
+    }
+    ~ImageSequenceWriter() { stop(); }
+
+    void write(const sk_sp<SkImage> &image, std::string path, sk_sp<SkData> buffer = nullptr)
+    {
+        std::unique_lock<std::mutex> lock(fMutex);
+        if (fClosed)
+            throw std::runtime_error("ImageSequenceWriter is closed.");
+        fCanPush.wait(lock, [this] { return fJobs.size() + fActive < fMaxPending; });
+        fJobs.push_back({image, std::move(buffer), std::move(path)});
+        fCanPop.notify_one();
+    }
+
+    // Returns a pooled buffer of exactly *size* bytes, or a new one if there is none. Frames of a sequence all have the
+    // same size, so an exact match is the common case and keeps the pool from handing out oversized buffers.
+    sk_sp<SkData> takeBuffer(size_t size)
+    {
+        std::lock_guard<std::mutex> lock(fMutex);
+        for (auto it = fPool.begin(); it != fPool.end(); ++it)
+            if ((*it)->size() == size)
+            {
+                sk_sp<SkData> buffer = std::move(*it);
+                fPool.erase(it);
+                return buffer;
+            }
+        return SkData::MakeUninitialized(size);
+    }
+
+    size_t pending()
+    {
+        std::lock_guard<std::mutex> lock(fMutex);
+        return fJobs.size() + fActive;
+    }
+
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(fMutex);
+        fIdle.wait(lock, [this] { return fJobs.empty() && fActive == 0; });
+        if (!fError.empty())
+        {
+            std::string error = std::move(fError);
+            fError.clear();
+            throw std::runtime_error(error);
+        }
+    }
+
+    void close()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
+        stop();
+    }
+
+    // Stops the worker threads after the queued images are written, without raising their errors.
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(fMutex);
+            if (fClosed)
+                return;
+            fClosed = true;
+        }
+        fCanPop.notify_all();
+        for (std::thread &thread : fThreads)
+            thread.join();
+        fThreads.clear();
+    }
+
+private:
+    struct Job
+    {
+        sk_sp<SkImage> image;
+        sk_sp<SkData> buffer;
+        std::string path;
+    };
+
+    SkEncodedImageFormat fFormat;
+    int fQuality;
+    size_t fMaxPending;
+    std::vector<std::thread> fThreads;
+    std::deque<Job> fJobs;
+    std::vector<sk_sp<SkData>> fPool;
+    size_t fActive = 0;
+    bool fClosed = false;
+    std::string fError;
+    std::mutex fMutex;
+    std::condition_variable fCanPush, fCanPop, fIdle;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(fMutex);
+        while (true)
+        {
+            fCanPop.wait(lock, [this] { return fClosed || !fJobs.empty(); });
+            if (fJobs.empty())
+                return;
+            Job job = std::move(fJobs.front());
+            fJobs.pop_front();
+            ++fActive;
+            lock.unlock();
+
+            std::string error = encodeAndWrite(job);
+            job.image.reset();
+
+            lock.lock();
+            if (!error.empty() && fError.empty())
+                fError = std::move(error);
+            if (job.buffer && job.buffer->unique() && fPool.size() < fMaxPending)
+                fPool.push_back(std::move(job.buffer));
+            --fActive;
+            fCanPush.notify_one();
+            if (fJobs.empty() && fActive == 0)
+                fIdle.notify_all();
+        }
+    }
+
+    std::string encodeAndWrite(const Job &job) const
+    {
+        sk_sp<SkData> data = encodeToData(job.image.get(), fFormat, fQuality);
+        if (!data)
+            return "Failed to encode image for " + job.path + ".";
+        SkFILEWStream stream(job.path.c_str());
+        if (!stream.isValid() || !stream.write(data->data(), data->size()))
+            return "Failed to write data to file " + job.path + ".";
+        return "";
+    }
+};
+
+void initImageSequenceWriter(py::module &m)
+{
+    py::class_<ImageSequenceWriter>(m, "ImageSequenceWriter", R"doc(
+        Encodes images and writes them to files on a pool of background threads, so that encoding does not block
+        rendering. :py:meth:`write` blocks while *maxPending* images are waiting to be written, which keeps the memory
+        usage bounded when encoding is slower than rendering. Errors are raised by the next :py:meth:`flush` or
+        :py:meth:`close`.
+
+        Can be used as a context manager, which closes the writer on exit. If the block raised an exception, the
+        writer is stopped without raising the errors of the pending images, so that the exception is not replaced.
+    )doc")
+        .def(py::init<const SkEncodedImageFormat &, const int &, int, int>(),
+             R"doc(
+                :param format: The format of the images. Should be one of :py:attr:`EncodedImageFormat.kJPEG`,
+                    :py:attr:`EncodedImageFormat.kPNG`, :py:attr:`EncodedImageFormat.kWEBP`.
+                :param quality: The quality of the images. 100 is the best quality.
+                :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+                :param maxPending: The maximum number of images waiting to be written. If ``0``, twice the number of
+                    workers is used.
+            )doc",
+             "format"_a = SkEncodedImageFormat::kPNG, "quality"_a = 100, "workers"_a = 0, "maxPending"_a = 0)
+        .def(
+            "write",
+            [](ImageSequenceWriter &self, const sk_sp<SkImage> &image, std::string path)
+            {
+                if (!image)
+                    throw py::value_error("Image must not be None.");
+                sk_sp<SkImage> raster = image->makeRasterImage(nullptr);
+                if (!raster)
+                    throw py::value_error("Failed to read image pixels.");
+                self.write(raster, std::move(path));
+            },
+            R"doc(
+                Queues *image* to be written to *path*. The image must not be backed by memory that changes later,
+                like an image created with ``Image.fromarray(array, copy=False)``; write the array instead.
+            )doc",
+            "image"_a, "path"_a, ReleaseGIL())
+        .def(
+            "write",
+            [](ImageSequenceWriter &self, const py::array &array, std::string path, const SkColorType &ct,
+               const SkAlphaType &at, const sk_sp<SkColorSpace> &cs)
+            {
+                const SkImageInfo info = ndarrayToImageInfo(array, ct, at, cs);
+                const size_t rowBytes = info.minRowBytes(), srcRowBytes = array.strides(0);
+                const char *src = static_cast<const char *>(array.data());
+
+                py::gil_scoped_release release;
+                sk_sp<SkData> buffer = self.takeBuffer(info.computeByteSize(rowBytes));
+                if (!buffer)
+                    throw std::bad_alloc();
+                char *dst = static_cast<char *>(buffer->writable_data());
+                for (int y = 0; y < info.height(); ++y)
+                    std::memcpy(dst + y * rowBytes, src + y * srcRowBytes, rowBytes);
+                sk_sp<SkImage> image = SkImages::RasterFromData(info, buffer, rowBytes);
+                if (!image)
+                    throw std::runtime_error("Failed to create image.");
+                self.write(image, std::move(path), std::move(buffer));
+            },
+            R"doc(
+                Copies the pixels of *array* (like :py:attr:`Scene.frame`) and queues them to be written to *path*.
+                The array can be modified as soon as this returns.
+
+                :param array: numpy array of shape=(height, width, channels) and appropriate dtype.
+                :param path: The path of the file.
+                :param ct: The color type of the array.
+                :param at: The alpha type of the array.
+                :param cs: The color space of the array.
+            )doc",
+            "array"_a, "path"_a, "ct"_a = SkColorType::kN32_SkColorType, "at"_a = SkAlphaType::kUnpremul_SkAlphaType,
+            "cs"_a = nullptr)
+        .def("pending", &ImageSequenceWriter::pending, "Returns the number of images that are not written yet.")
+        .def("flush", &ImageSequenceWriter::flush,
+             "Waits until all queued images are written. Raises the first error that occurred since the last flush.",
+             ReleaseGIL())
+        .def("close", &ImageSequenceWriter::close,
+             "Flushes the writer and stops the worker threads. No more images can be written after this.",
+             ReleaseGIL())
+        .def("__enter__", [](ImageSequenceWriter &self) -> ImageSequenceWriter & { return self; },
+             py::return_value_policy::reference)
+        .def("__exit__",
+             [](ImageSequenceWriter &self, const py::object &excType, const py::object &, const py::object &)
+             {
+                 const bool raised = !excType.is_none();
+                 py::gil_scoped_release release;
+                 if (raised)
+                     self.stop();
+                 else
+                     self.close();
+             });
+}
@@ -0,0 +1,372 @@
+#include "common.h"
+#include "extras/parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// Gradient functions from Stefan Gustavson's noise1234, shared by Perlin and simplex noise. The low bits of *hash*
+// select a gradient, and the result is its dot product with the offset from the lattice point.
+static inline float grad(int hash, const float *x, int dims)
+{
+    switch (dims)
+    {
+    case 1:
+    {
+        const float g = 1.0f + (hash & 7);
+        return (hash & 8 ? -g : g) * x[0];
+    }
+    case 2:
+    {
+        const int h = hash & 7;
+        const float u = h < 4 ? x[0] : x[1], v = h < 4 ? x[1] : x[0];
+        return (h & 1 ? -u : u) + (h & 2 ? -2.0f * v : 2.0f * v);
+    }
+    case 3:
+    {
+        const int h = hash & 15;
+        const float u = h < 8 ? x[0] : x[1], v = h < 4 ? x[1] : h == 12 || h == 14 ? x[0] : x[2];
+        return (h & 1 ? -u : u) + (h & 2 ? -v : v);
+    }
+    default:
+    {
+        const int h = hash & 31;
+        const float u = h < 24 ? x[0] : x[1], v = h < 16 ? x[1] : x[2], w = h < 8 ? x[2] : x[3];
+        return (h & 1 ? -u : u) + (h & 2 ? -v : v) + (h & 4 ? -w : w);
+    }
+    }
+}
+
+// Seeded, deterministic coherent noise in 1 to 4 dimensions, summed over octaves (fractional Brownian motion). Every
+// type returns values in [0, 1), like Processing's noise(): each octave is mapped to [0, 1] and the first one has an
+// amplitude of 0.5.
+class Noise
+{
+public:
+    enum class Type
+    {
+        kPerlin,
+        kSimplex,
+        kValue,
+    };
+
+    Noise(uint64_t seed, Type type, int octaves, float falloff, float lacunarity) : fType(type)
+    {
+        setOctaves(octaves);
+        setFalloff(falloff);
+        setLacunarity(lacunarity);
+        // splitmix64, so that the tables are the same on every platform.
+        auto next = [&seed]()
+        {
+            uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        };
+        for (int i = 0; i < 256; ++i)
+            fPerm[i] = static_cast<uint8_t>(i);
+        for (int i = 255; i > 0; --i)
+            std::swap(fPerm[i], fPerm[next() % (i + 1)]);
+        std::copy_n(fPerm, 256, fPerm + 256);
+        for (float &value : fValues)
+            value = (next() >> 40) * (1.0f / (1 << 24));
+    }
+
+    // The noise at the point *p* with *dims* coordinates.
+    float operator()(const float *p, int dims) const
+    {
+        float q[4], sum = 0, amplitude = 0.5f, frequency = 1;
+        for (int o = 0; o < fOctaves; ++o)
+        {
+            for (int d = 0; d < dims; ++d)
+                q[d] = p[d] * frequency;
+            float n;
+            switch (fType)
+            {
+            case Type::kPerlin:
+                n = 0.5f * (perlin(q, dims) + 1);
+                break;
+            case Type::kSimplex:
+                n = 0.5f * (simplex(q, dims) + 1);
+                break;
+            default:
+                n = value(q, dims);
+                break;
+            }
+            sum += SkTPin(n, 0.0f, 1.0f) * amplitude;
+            amplitude *= fFalloff;
+            frequency *= fLacunarity;
+        }
+        return sum;
+    }
+
+    void checkDimensions(int dims) const
+    {
+        if (dims < 1 || dims > 4)
+            throw py::value_error("Noise needs 1 to 4 coordinates.");
+        if (fType == Type::kValue && dims == 4)
+            throw py::value_error("Value noise supports up to 3 coordinates.");
+    }
+
+    Type type() const { return fType; }
+    int getOctaves() const { return fOctaves; }
+    void setOctaves(int octaves)
+    {
+        if (octaves < 1 || octaves > 32)
+            throw py::value_error("octaves must be in [1, 32].");
+        fOctaves = octaves;
+    }
+    float getFalloff() const { return fFalloff; }
+    void setFalloff(float falloff) { fFalloff = falloff; }
+    float getLacunarity() const { return fLacunarity; }
+    void setLacunarity(float lacunarity) { fLacunarity = lacunarity; }
+
+private:
+    Type fType;
+    int fOctaves;
+    float fFalloff, fLacunarity;
+    uint8_t fPerm[512];
+    float fValues[4096];
+
+    static float fade(float t) { return t * t * t * (t * (t * 6 - 15) + 10); }
+
+    // Improved Perlin noise, as the multilinear interpolation of the gradients at the corners of the cell.
+    float perlin(const float *p, int dims) const
+    {
+        static constexpr float kScale[] = {0.188f, 0.507f, 0.936f, 0.87f};
+        int cell[4];
+        float f[4], u[4], x[4];
+        for (int d = 0; d < dims; ++d)
+        {
+            const float floor = std::floor(p[d]);
+            cell[d] = static_cast<int>(floor) & 255;
+            f[d] = p[d] - floor;
+            u[d] = fade(f[d]);
+        }
+        float result = 0;
+        for (int corner = 0; corner < 1 << dims; ++corner)
+        {
+            int hash = 0;
+            float weight = 1;
+            for (int d = dims - 1; d >= 0; --d)
+            {
+                const int bit = corner >> d & 1;
+                hash = fPerm[((cell[d] + bit) & 255) + hash];
+                x[d] = f[d] - bit;
+                weight *= bit ? u[d] : 1 - u[d];
+            }
+            result += weight * grad(hash, x, dims);
+        }
+        return kScale[dims - 1] * result;
+    }
+
+    // Simplex noise. The space is skewed so that the simplex containing the point is found by ranking the offsets
+    // from the cell origin, and the contribution of each of its corners falls off radially.
+    float simplex(const float *p, int dims) const
+    {
+        if (dims == 1)
+        {
+            const float floor = std::floor(p[0]);
+            const int i = static_cast<int>(floor) & 255;
+            float x[1] = {p[0] - floor}, result = 0;
+            for (int k = 0; k < 2; ++k, x[0] -= 1)
+            {
+                const float t = 1 - x[0] * x[0];
+                result += t * t * t * t * grad(fPerm[(i + k) & 255], x, 1);
+            }
+            return 0.395f * result;
+        }
+
+        static constexpr float kSkew[] = {0, 0.366025403f, 1.0f / 3, 0.309016994f},
+                               kUnskew[] = {0, 0.211324865f, 1.0f / 6, 0.138196601f},
+                               kRadius[] = {0, 0.5f, 0.6f, 0.6f}, kScale[] = {0, 40.0f, 32.0f, 27.0f};
+        const float F = kSkew[dims - 1], G = kUnskew[dims - 1];
+        float s = 0, t = 0;
+        for (int d = 0; d < dims; ++d)
+            s += p[d];
+        s *= F;
+        int cell[4], rank[4] = {};
+        float x0[4], x[4];
+        for (int d = 0; d < dims; ++d)
+        {
+            cell[d] = static_cast<int>(std::floor(p[d] + s));
+            t += cell[d];
+        }
+        t *= G;
+        for (int d = 0; d < dims; ++d)
+            x0[d] = p[d] - (cell[d] - t);
+        for (int a = 0; a < dims; ++a)
+            for (int b = a + 1; b < dims; ++b)
+                ++rank[x0[a] > x0[b] ? a : b];
+
+        float result = 0;
+        for (int k = 0; k <= dims; ++k)
+        {
+            int hash = 0;
+            float falloff = kRadius[dims - 1];
+            for (int d = dims - 1; d >= 0; --d)
+            {
+                // Corner k moves one step along the k largest offsets.
+                const int step = k > 0 && rank[d] >= dims - k;
+                hash = fPerm[((cell[d] + step) & 255) + hash];
+                x[d] = x0[d] - step + k * G;
+                falloff -= x[d] * x[d];
+            }
+            if (falloff > 0)
+                result += falloff * falloff * falloff * falloff * grad(hash, x, dims);
+        }
+        return kScale[dims - 1] * result;
+    }
+
+    // Processing's noise: smoothly interpolated random values on a lattice folded into a table of 4096 values.
+    float value(const float *p, int dims) const
+    {
+        uint32_t cell[3] = {};
+        float f[3] = {}, u[3];
+        for (int d = 0; d < dims; ++d)
+        {
+            const float a = std::abs(p[d]);
+            cell[d] = static_cast<uint32_t>(a);
+            f[d] = a - cell[d];
+        }
+        for (int d = 0; d < 3; ++d)
+            u[d] = 0.5f * (1 - std::cos(f[d] * SK_FloatPI));
+        const uint32_t offset = cell[0] + (cell[1] << 4) + (cell[2] << 8);
+        auto at = [this, offset](uint32_t i) { return fValues[(offset + i) & 4095]; };
+        auto lerp = [](float a, float b, float t) { return a + t * (b - a); };
+        const float n1 = lerp(lerp(at(0), at(1), u[0]), lerp(at(16), at(17), u[0]), u[1]),
+                    n2 = lerp(lerp(at(256), at(257), u[0]), lerp(at(272), at(273), u[0]), u[1]);
+        return lerp(n1, n2, u[2]);
+    }
+};
+
+void initNoise(py::module &m)
+{
+    py::class_<Noise> noise(m, "Noise", R"doc(
+        Seeded, deterministic coherent noise in 1 to 4 dimensions, summed over several octaves (fractional Brownian
+        motion). By default, each octave doubles the frequency and halves the amplitude. Like Processing's ``noise()``,
+        the result is in [0, 1) as long as the falloff is at most 0.5.
+
+        A :py:class:`Noise` can be evaluated at a single point, over an array of points, or over a whole grid into an
+        array with :py:meth:`fill`. Array evaluations release the GIL and are split over multiple threads.
+    )doc");
+
+    py::enum_<Noise::Type>(noise, "Type")
+        .value("kPerlin", Noise::Type::kPerlin, "Improved Perlin gradient noise.")
+        .value("kSimplex", Noise::Type::kSimplex, "Simplex noise, which has fewer directional artifacts.")
+        .value("kValue", Noise::Type::kValue, "Processing's value noise, up to 3 dimensions.");
+
+    noise
+        .def(py::init<uint64_t, Noise::Type, int, float, float>(),
+             R"doc(
+                :param seed: The seed. Noises with the same seed and parameters always return the same values.
+                :param type: The type of noise.
+                :param octaves: The number of octaves, in [1, 32].
+                :param falloff: The factor the amplitude is multiplied by for each octave.
+                :param lacunarity: The factor the frequency is multiplied by for each octave.
+            )doc",
+             "seed"_a = 0, "type"_a = Noise::Type::kPerlin, "octaves"_a = 4, "falloff"_a = 0.5f,
+             "lacunarity"_a = 2.0f)
+        .def_property_readonly("type", &Noise::type)
+        .def_property("octaves", &Noise::getOctaves, &Noise::setOctaves)
+        .def_property("falloff", &Noise::getFalloff, &Noise::setFalloff)
+        .def_property("lacunarity", &Noise::getLacunarity, &Noise::setLacunarity)
+        .def(
+            "__call__",
+            [](const Noise &self, float x, std::optional<float> y, std::optional<float> z, std::optional<float> w)
+            {
+                const float p[4] = {x, y.value_or(0), z.value_or(0), w.value_or(0)};
+                const int dims = w ? 4 : z ? 3 : y ? 2 : 1;
+                self.checkDimensions(dims);
+                return self(p, dims);
+            },
+            "Returns the noise at the point (*x*, *y*, *z*, *w*). Omitted coordinates reduce the dimensions.", "x"_a,
+            "y"_a = py::none(), "z"_a = py::none(), "w"_a = py::none())
+        .def(
+            "__call__",
+            [](const Noise &self, const py::array_t<float, py::array::c_style | py::array::forcecast> &points,
+               int workers)
+            {
+                if (points.ndim() < 1)
+                    throw py::value_error("points must have at least 1 dimension.");
+                const int dims = static_cast<int>(points.shape(points.ndim() - 1));
+                self.checkDimensions(dims);
+                FloatArray result(std::vector<py::ssize_t>(points.shape(), points.shape() + points.ndim() - 1));
+                const float *in = points.data();
+                float *out = result.mutable_data();
+                const size_t count = result.size(), blockSize = 4096;
+                {
+                    py::gil_scoped_release release;
+                    parallelFor((count + blockSize - 1) / blockSize, workers,
+                                [&](int, size_t block)
+                                {
+                                    for (size_t i = block * blockSize, end = std::min(i + blockSize, count); i < end;
+                                         ++i)
+                                        out[i] = self(in + i * dims, dims);
+                                });
+                }
+                return result;
+            },
+            R"doc(
+                Returns the noise at every point of *points*, an array of shape=(..., D) with D in [1, 4] coordinates
+                per point. The result has the shape of *points* without the last dimension.
+
+                :param points: The points.
+                :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+            )doc",
+            "points"_a, "workers"_a = 0)
+        .def(
+            "fill",
+            [](const Noise &self, py::array array, float x, float y, std::optional<float> z, float scale,
+               int workers)
+            {
+                const bool isFloat = py::isinstance<py::array_t<float>>(array),
+                           isByte = py::isinstance<py::array_t<uint8_t>>(array);
+                if (!isFloat && !isByte)
+                    throw py::value_error("array must be of dtype float32 or uint8.");
+                if (array.ndim() != 2 && array.ndim() != 3)
+                    throw py::value_error("array must have shape=(height, width) or (height, width, channels).");
+                if (!(array.flags() & py::array::c_style))
+                    throw py::value_error("array must be C-contiguous.");
+                const int dims = z ? 3 : 2;
+                self.checkDimensions(dims);
+                const size_t height = array.shape(0), width = array.shape(1),
+                             channels = array.ndim() == 3 ? array.shape(2) : 1;
+                void *data = array.mutable_data();
+
+                py::gil_scoped_release release;
+                parallelFor(height, workers,
+                            [&](int, size_t row)
+                            {
+                                float p[3] = {0, y + row * scale, z.value_or(0)};
+                                for (size_t col = 0; col < width; ++col)
+                                {
+                                    p[0] = x + col * scale;
+                                    const float n = self(p, dims);
+                                    const uint8_t byte = static_cast<uint8_t>(SkTPin(n * 256, 0.0f, 255.0f));
+                                    const size_t i = (row * width + col) * channels;
+                                    for (size_t c = 0; c < channels; ++c)
+                                        if (isFloat)
+                                            static_cast<float *>(data)[i + c] = n;
+                                        else
+                                            static_cast<uint8_t *>(data)[i + c] = channels == 4 && c == 3 ? 255 : byte;
+                                }
+                            });
+            },
+            R"doc(
+                Fills *array* with the noise over a grid, in parallel. The pixel at (row, col) gets the noise at
+                (*x* + col * *scale*, *y* + row * *scale*) or, if *z* is given, at (..., *z*), which can be used to
+                animate the texture. Every channel of a pixel gets the same value, except the alpha channel of a 4
+                channel uint8 array, which is set to ``255``, so the array of a :py:class:`Canvas` can be filled
+                directly. The GIL is released while filling.
+
+                :param array: A C-contiguous float32 or uint8 array of shape=(height, width) or
+                    (height, width, channels). Float arrays get values in [0, 1), and uint8 arrays in [0, 255]. A
+                    negative *falloff* can give values outside of [0, 1), which uint8 arrays clamp.
+                :param x: The x coordinate of the first column.
+                :param y: The y coordinate of the first row.
+                :param z: The z coordinate of the grid. If ``None``, 2D noise is used.
+                :param scale: The distance between adjacent pixels in noise coordinates.
+                :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+            )doc",
+            "array"_a, "x"_a = 0, "y"_a = 0, "z"_a = py::none(), "scale"_a = 0.01f, "workers"_a = 0);
+}
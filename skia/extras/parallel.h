@@ -0,0 +1,67 @@
+#ifndef _PARALLEL_H_
+#define _PARALLEL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Returns the number of worker threads to use for *count* jobs. If *workers* is not positive, the number of hardware
+// threads is used.
+static inline int resolveWorkers(int workers, size_t count)
+{
+    if (workers <= 0)
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    return static_cast<int>(std::min<size_t>(workers, std::max<size_t>(count, 1)));
+}
+
+// Runs *worker(workerIndex)* on *workers* threads and waits for all of them to finish. The calling thread is used as
+// the last worker. The first exception thrown by any worker is rethrown after all the workers have finished. The GIL
+// must be released by the caller if the workers do not touch any Python object.
+template <typename F>
+void runWorkers(int workers, F &&worker)
+{
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto run = [&](int index)
+    {
+        try
+        {
+            worker(index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+                error = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (int i = 0; i < workers - 1; ++i)
+        threads.emplace_back(run, i);
+    run(workers - 1);
+    for (std::thread &thread : threads)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+// Runs *job(workerIndex, jobIndex)* for every job in [0, count) on *workers* threads. Jobs are handed out one at a time
+// in increasing order, so that slow jobs do not hold up the others.
+template <typename F>
+void parallelFor(size_t count, int workers, F &&job)
+{
+    std::atomic<size_t> next{0};
+    runWorkers(resolveWorkers(workers, count),
+               [&](int worker)
+               {
+                   for (size_t i = next++; i < count; i = next++)
+                       job(worker, i);
+               });
+}
+
+#endif
@@ -0,0 +1,335 @@
+#include "common.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkRSXform.h"
+#include "include/core/SkVertices.h"
+#include <algorithm>
+#include <cmath>
+#include <pybind11/stl.h>
+
+// The ranges that new particles are sampled from. Every value is sampled uniformly between its min and max.
+struct ParticleEmitter
+{
+    SkPoint position{0, 0};
+    SkPoint extent{0, 0};
+    float rate = 0;
+    float minSpeed = 0, maxSpeed = 100;
+    float minAngle = 0, maxAngle = 360;
+    float minLife = 1, maxLife = 1;
+    float minScale = 1, maxScale = 1;
+    float minSpin = 0, maxSpin = 0;
+    SkColor4f startColor = SkColors::kWhite, endColor = SkColors::kWhite;
+};
+
+struct ParticleAttractor
+{
+    SkPoint position;
+    float strength;
+};
+
+// Particles stored as a structure of arrays, so that every loop in step() runs over contiguous floats without branches
+// and can be vectorized by the compiler. Dead particles are removed by moving the last particle into their place, so
+// the live particles are always the first count() elements.
+class ParticleSystem
+{
+public:
+    ParticleEmitter emitter;
+    SkPoint gravity{0, 0};
+    float drag = 0;
+    std::vector<ParticleAttractor> attractors;
+
+    ParticleSystem(size_t capacity, uint32_t seed) : fCapacity(capacity), fRandom(seed ? seed : 0x9E3779B9)
+    {
+        for (std::vector<float> *field : {&fX, &fY, &fVX, &fVY, &fAge, &fLife, &fRotation, &fSpin, &fScale})
+            field->resize(capacity);
+        fColor.resize(capacity);
+    }
+
+    size_t count() const { return fCount; }
+    size_t capacity() const { return fCapacity; }
+    void clear() { fCount = 0; }
+
+    // Spawns up to *n* particles from the emitter, limited by the free capacity.
+    void emit(size_t n)
+    {
+        n = std::min(n, fCapacity - fCount);
+        const SkColor color = emitter.startColor.toSkColor();
+        for (size_t i = fCount; i < fCount + n; ++i)
+        {
+            const float angle = SkDegreesToRadians(random(emitter.minAngle, emitter.maxAngle)),
+                        speed = random(emitter.minSpeed, emitter.maxSpeed);
+            fX[i] = emitter.position.fX + random(-emitter.extent.fX, emitter.extent.fX);
+            fY[i] = emitter.position.fY + random(-emitter.extent.fY, emitter.extent.fY);
+            fVX[i] = speed * std::cos(angle);
+            fVY[i] = speed * std::sin(angle);
+            fAge[i] = 0;
+            fLife[i] = std::max(random(emitter.minLife, emitter.maxLife), 1e-6f);
+            fRotation[i] = 0;
+            fSpin[i] = SkDegreesToRadians(random(emitter.minSpin, emitter.maxSpin));
+            fScale[i] = random(emitter.minScale, emitter.maxScale);
+            fColor[i] = color;
+        }
+        fCount += n;
+    }
+
+    void step(float dt)
+    {
+        float *age = fAge.data();
+        for (size_t i = 0; i < fCount; ++i)
+            age[i] += dt;
+        for (size_t i = 0; i < fCount;)
+            if (fAge[i] >= fLife[i])
+                moveParticle(--fCount, i);
+            else
+                ++i;
+
+        fPendingEmits += emitter.rate * dt;
+        const size_t n = static_cast<size_t>(fPendingEmits);
+        fPendingEmits -= n;
+        emit(n);
+
+        const size_t count = fCount;
+        float *x = fX.data(), *y = fY.data(), *vx = fVX.data(), *vy = fVY.data(), *rotation = fRotation.data();
+        const float *life = fLife.data(), *spin = fSpin.data();
+        for (const ParticleAttractor &attractor : attractors)
+        {
+            const float ax = attractor.position.fX, ay = attractor.position.fY, k = attractor.strength * dt;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float dx = ax - x[i], dy = ay - y[i], f = k / (dx * dx + dy * dy + 1);
+                vx[i] += dx * f;
+                vy[i] += dy * f;
+            }
+        }
+        const float damping = std::exp(-drag * dt), gx = gravity.fX * dt, gy = gravity.fY * dt;
+        for (size_t i = 0; i < count; ++i)
+        {
+            vx[i] = (vx[i] + gx) * damping;
+            vy[i] = (vy[i] + gy) * damping;
+            x[i] += vx[i] * dt;
+            y[i] += vy[i] * dt;
+            rotation[i] += spin[i] * dt;
+        }
+
+        const SkColor4f start = emitter.startColor, delta = {emitter.endColor.fR - start.fR,
+                                                             emitter.endColor.fG - start.fG,
+                                                             emitter.endColor.fB - start.fB,
+                                                             emitter.endColor.fA - start.fA};
+        SkColor *color = fColor.data();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float t = age[i] / life[i];
+            color[i] = toByte(start.fA + delta.fA * t) << 24 | toByte(start.fR + delta.fR * t) << 16 |
+                       toByte(start.fG + delta.fG * t) << 8 | toByte(start.fB + delta.fB * t);
+        }
+    }
+
+    // Draws every particle with a single drawAtlas() call if *sprite* is given, or with indexed drawVertices() calls of
+    // squares with side *size* otherwise, one call per kQuadsPerBatch particles.
+    void draw(SkCanvas *canvas, const SkPaint &paint, const sk_sp<SkImage> &sprite, float size,
+              const SkSamplingOptions &sampling)
+    {
+        if (fCount == 0)
+            return;
+        if (sprite)
+        {
+            const float cx = sprite->width() * 0.5f, cy = sprite->height() * 0.5f;
+            fXforms.resize(fCount);
+            fTex.assign(fCount, SkRect::Make(sprite->bounds()));
+            for (size_t i = 0; i < fCount; ++i)
+            {
+                const float c = fScale[i] * std::cos(fRotation[i]), s = fScale[i] * std::sin(fRotation[i]);
+                fXforms[i] = SkRSXform::Make(c, s, fX[i] - c * cx + s * cy, fY[i] - s * cx - c * cy);
+            }
+            canvas->drawAtlas(sprite.get(), fXforms.data(), fTex.data(), fColor.data(), fCount, SkBlendMode::kModulate,
+                              sampling, nullptr, &paint);
+            return;
+        }
+
+        const size_t quads = std::min(fCount, kQuadsPerBatch);
+        for (size_t i = fQuadIndices.size() / 6; i < quads; ++i)
+        {
+            const uint16_t v = static_cast<uint16_t>(4 * i);
+            fQuadIndices.insert(fQuadIndices.end(), {v, uint16_t(v + 1), uint16_t(v + 2), v, uint16_t(v + 2),
+                                                     uint16_t(v + 3)});
+        }
+        for (size_t first = 0; first < fCount; first += kQuadsPerBatch)
+        {
+            const size_t n = std::min(kQuadsPerBatch, fCount - first);
+            SkVertices::Builder builder(SkVertices::kTriangles_VertexMode, 4 * n, 6 * n,
+                                        SkVertices::kHasColors_BuilderFlag);
+            SkPoint *positions = builder.positions();
+            SkColor *colors = builder.colors();
+            std::copy_n(fQuadIndices.data(), 6 * n, builder.indices());
+            for (size_t j = 0; j < n; ++j)
+            {
+                const size_t i = first + j;
+                const float h = 0.5f * size * fScale[i], c = h * std::cos(fRotation[i]),
+                            s = h * std::sin(fRotation[i]);
+                SkPoint *quad = positions + 4 * j;
+                quad[0] = {fX[i] - c + s, fY[i] - s - c};
+                quad[1] = {fX[i] + c + s, fY[i] + s - c};
+                quad[2] = {fX[i] + c - s, fY[i] + s + c};
+                quad[3] = {fX[i] - c - s, fY[i] - s + c};
+                std::fill_n(colors + 4 * j, 4, fColor[i]);
+            }
+            canvas->drawVertices(builder.detach(), SkBlendMode::kDst, paint);
+        }
+    }
+
+    SkRect bounds(const sk_sp<SkImage> &sprite, float size) const
+    {
+        if (fCount == 0)
+            return SkRect::MakeEmpty();
+        const float radius = sprite ? 0.5f * std::hypot(sprite->width(), sprite->height()) : size * SK_ScalarRoot2Over2;
+        float left = SK_ScalarInfinity, top = SK_ScalarInfinity, right = SK_ScalarNegativeInfinity,
+              bottom = SK_ScalarNegativeInfinity;
+        for (size_t i = 0; i < fCount; ++i)
+        {
+            const float r = radius * std::abs(fScale[i]);
+            left = std::min(left, fX[i] - r);
+            top = std::min(top, fY[i] - r);
+            right = std::max(right, fX[i] + r);
+            bottom = std::max(bottom, fY[i] + r);
+        }
+        return SkRect::MakeLTRB(left, top, right, bottom);
+    }
+
+    py::array positions() const
+    {
+        FloatArray array({py::ssize_t(fCount), py::ssize_t(2)});
+        float *data = array.mutable_data();
+        for (size_t i = 0; i < fCount; ++i)
+            data[2 * i] = fX[i], data[2 * i + 1] = fY[i];
+        return array;
+    }
+
+private:
+    static constexpr size_t kQuadsPerBatch = 1 << 14; // 4 vertices per quad, so that the indices fit in uint16_t
+
+    size_t fCapacity, fCount = 0;
+    uint32_t fRandom;
+    float fPendingEmits = 0;
+    std::vector<float> fX, fY, fVX, fVY, fAge, fLife, fRotation, fSpin, fScale;
+    std::vector<SkColor> fColor;
+    std::vector<SkRSXform> fXforms;
+    std::vector<SkRect> fTex;
+    std::vector<uint16_t> fQuadIndices; // two triangles per quad, shared by every batch
+
+    float random(float min, float max)
+    {
+        fRandom ^= fRandom << 13;
+        fRandom ^= fRandom >> 17;
+        fRandom ^= fRandom << 5;
+        return min + (max - min) * ((fRandom >> 8) * (1.0f / (1 << 24)));
+    }
+
+    static uint32_t toByte(float value) { return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * 255 + 0.5f); }
+
+    void moveParticle(size_t from, size_t to)
+    {
+        fX[to] = fX[from], fY[to] = fY[from], fVX[to] = fVX[from], fVY[to] = fVY[from];
+        fAge[to] = fAge[from], fLife[to] = fLife[from], fRotation[to] = fRotation[from], fSpin[to] = fSpin[from];
+        fScale[to] = fScale[from], fColor[to] = fColor[from];
+    }
+};
+
+void initParticleSystem(py::module &m)
+{
+    py::class_<ParticleSystem> particleSystem(m, "ParticleSystem", R"doc(
+        A fixed capacity pool of particles that are spawned, simulated and drawn without touching Python. The position,
+        velocity, age, life, rotation, spin, scale and color of the particles are stored in separate arrays, and the
+        whole system is drawn with a single :py:meth:`Canvas.drawAtlas` call, or with a few indexed
+        :py:meth:`Canvas.drawVertices` calls of 4 vertices per particle.
+
+        Each :py:meth:`step` ages the particles and removes the dead ones, spawns new particles from the
+        :py:attr:`emitter`, applies the :py:attr:`gravity`, :py:attr:`drag` and attractors to the velocities, and moves
+        the particles. The color of each particle is interpolated from the emitter's *startColor* to *endColor* over its
+        life. The GIL is released while stepping and drawing.
+    )doc");
+
+    py::class_<ParticleEmitter>(particleSystem, "Emitter", R"doc(
+        Describes how new particles are spawned. Angles are in degrees, speeds in pixels per second and life in
+        seconds. Each value is sampled uniformly between its min and max.
+    )doc")
+        .def(py::init())
+        .def_readwrite("position", &ParticleEmitter::position, "The center of the area where particles are spawned.")
+        .def_readwrite("extent", &ParticleEmitter::extent,
+                       "The half width and half height of the rectangle around *position* where particles are spawned.")
+        .def_readwrite("rate", &ParticleEmitter::rate, "The number of particles spawned per second.")
+        .def_readwrite("minSpeed", &ParticleEmitter::minSpeed)
+        .def_readwrite("maxSpeed", &ParticleEmitter::maxSpeed)
+        .def_readwrite("minAngle", &ParticleEmitter::minAngle)
+        .def_readwrite("maxAngle", &ParticleEmitter::maxAngle)
+        .def_readwrite("minLife", &ParticleEmitter::minLife)
+        .def_readwrite("maxLife", &ParticleEmitter::maxLife)
+        .def_readwrite("minScale", &ParticleEmitter::minScale)
+        .def_readwrite("maxScale", &ParticleEmitter::maxScale)
+        .def_readwrite("minSpin", &ParticleEmitter::minSpin, "The minimum angular velocity in degrees per second.")
+        .def_readwrite("maxSpin", &ParticleEmitter::maxSpin, "The maximum angular velocity in degrees per second.")
+        .def_readwrite("startColor", &ParticleEmitter::startColor)
+        .def_readwrite("endColor", &ParticleEmitter::endColor);
+
+    particleSystem
+        .def(py::init(
+                 [](size_t capacity, uint32_t seed)
+                 {
+                     if (capacity == 0)
+                         throw py::value_error("capacity must be positive.");
+                     return ParticleSystem(capacity, seed);
+                 }),
+             R"doc(
+                :param capacity: The maximum number of live particles.
+                :param seed: The seed of the random number generator used to spawn particles.
+            )doc",
+             "capacity"_a, "seed"_a = 0)
+        .def_readwrite("emitter", &ParticleSystem::emitter)
+        .def_readwrite("gravity", &ParticleSystem::gravity, "The acceleration applied to every particle.")
+        .def_readwrite("drag", &ParticleSystem::drag,
+                       "The fraction of the velocity lost per second is ``1 - exp(-drag)``.")
+        .def(
+            "addAttractor",
+            [](ParticleSystem &self, const SkPoint &position, float strength)
+            { self.attractors.push_back({position, strength}); },
+            R"doc(
+                Adds a point that accelerates particles towards it by ``strength / distance``. A negative *strength*
+                repels the particles.
+            )doc",
+            "position"_a, "strength"_a)
+        .def("clearAttractors", [](ParticleSystem &self) { self.attractors.clear(); })
+        .def("count", &ParticleSystem::count, "Returns the number of live particles.")
+        .def("capacity", &ParticleSystem::capacity)
+        .def("clear", &ParticleSystem::clear, "Removes all particles.")
+        .def("emit", &ParticleSystem::emit, "Spawns up to *n* particles at once from the :py:attr:`emitter`.", "n"_a,
+             ReleaseGIL())
+        .def(
+            "step",
+            [](ParticleSystem &self, float dt)
+            {
+                if (dt < 0)
+                    throw py::value_error("dt must not be negative.");
+                py::gil_scoped_release release;
+                self.step(dt);
+            },
+            "Advances the simulation by *dt* seconds.", "dt"_a)
+        .def("draw", &ParticleSystem::draw,
+             R"doc(
+                Draws all particles on *canvas* with *paint*.
+
+                If *sprite* is given, each particle is drawn as *sprite* centered on its position, scaled by its scale,
+                rotated by its rotation, and modulated by its color. Otherwise, each particle is drawn as a square with
+                side ``size * scale`` filled with its color.
+
+                :param canvas: The canvas to draw on.
+                :param paint: The paint to draw with.
+                :param sprite: The image to draw for each particle.
+                :param size: The side of the squares drawn when *sprite* is ``None``.
+                :param sampling: The sampling options for *sprite*.
+            )doc",
+             "canvas"_a, "paint"_a, "sprite"_a = nullptr, "size"_a = 1, "sampling"_a = SkSamplingOptions(),
+             ReleaseGIL())
+        .def("bounds", &ParticleSystem::bounds, "Returns the bounds of the particles as drawn by :py:meth:`draw`.",
+             "sprite"_a = nullptr, "size"_a = 1, ReleaseGIL())
+        .def("positions", &ParticleSystem::positions,
+             "Returns a copy of the positions of the live particles as a float32 numpy array of shape=(N, 2).");
+}
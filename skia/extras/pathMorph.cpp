@@ -0,0 +1,45 @@
+#include "common.h"
+#include "extras/pathMorph.h"
+
+// The GIL is released while interpolating, so each thread lerps into its own buffer, which is reused across calls.
+static std::vector<SkPoint> &pointBuffer()
+{
+    thread_local std::vector<SkPoint> points;
+    return points;
+}
+
+void initPathMorph(py::module &m)
+{
+    py::class_<PathMorph>(m, "PathMorph", R"doc(
+        Interpolates between any two paths, unlike :py:meth:`Path.interpolate` which needs paths with the same verbs
+        and number of points.
+
+        The paths are prepared once when the :py:class:`PathMorph` is created. All segments are converted to cubics,
+        contours are paired from the largest to the smallest (a missing contour grows from a point), paired contours
+        are split to the same number of cubics, and closed contours are turned to the same direction with their start
+        points aligned. After that, each :py:meth:`interpolate` is a single linear interpolation of the points, so the
+        same morph should be reused for every frame of an animation.
+    )doc")
+        .def(py::init<const SkPath &, const SkPath &>(), "start"_a, "end"_a, ReleaseGIL())
+        .def(
+            "interpolate",
+            [](const PathMorph &self, SkScalar t)
+            {
+                SkPath path;
+                self.interpolate(t, path, pointBuffer());
+                return path;
+            },
+            R"doc(
+                Returns the path at *t*, which is *start* at ``0`` and *end* at ``1``. *t* outside of [0, 1]
+                extrapolates. The fill type and whether each contour is closed are taken from *start* if *t* < 0.5,
+                else from *end*.
+            )doc",
+            "t"_a, ReleaseGIL())
+        .def(
+            "interpolate",
+            [](const PathMorph &self, SkScalar t, SkPath &dst) { self.interpolate(t, dst, pointBuffer()); },
+            "Same as above, but replaces the content of *dst* with the path at *t*, reusing its memory.", "t"_a,
+            "dst"_a, ReleaseGIL())
+        .def("countContours", &PathMorph::countContours)
+        .def("countPoints", &PathMorph::countPoints);
+}
@@ -0,0 +1,268 @@
+#ifndef _PATH_MORPH_H_
+#define _PATH_MORPH_H_
+
+#include "common.h"
+#include "include/core/SkPath.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+// A contour made only of cubics. The first point is the start point, followed by 3 points for each cubic.
+struct MorphContour
+{
+    std::vector<SkPoint> points;
+    bool closed = false;
+
+    size_t segments() const { return points.size() / 3; }
+    const SkPoint *cubic(size_t i) const { return &points[3 * i]; }
+};
+
+// Splits the cubic *src* at *t* into *left* and *right* (de Casteljau).
+static inline void splitCubic(const SkPoint src[4], SkScalar t, SkPoint left[4], SkPoint right[4])
+{
+    const SkPoint ab = src[0] + (src[1] - src[0]) * t, bc = src[1] + (src[2] - src[1]) * t,
+                  cd = src[2] + (src[3] - src[2]) * t, abc = ab + (bc - ab) * t, bcd = bc + (cd - bc) * t,
+                  abcd = abc + (bcd - abc) * t;
+    left[0] = src[0], left[1] = ab, left[2] = abc, left[3] = abcd;
+    right[0] = abcd, right[1] = bcd, right[2] = cd, right[3] = src[3];
+}
+
+static inline SkScalar cubicLength(const SkPoint cubic[4])
+{
+    const SkScalar net = SkPoint::Distance(cubic[0], cubic[1]) + SkPoint::Distance(cubic[1], cubic[2]) +
+                         SkPoint::Distance(cubic[2], cubic[3]);
+    return (net + SkPoint::Distance(cubic[0], cubic[3])) * 0.5f;
+}
+
+static inline void addCubic(MorphContour &contour, const SkPoint &p1, const SkPoint &p2, const SkPoint &p3)
+{
+    contour.points.push_back(p1);
+    contour.points.push_back(p2);
+    contour.points.push_back(p3);
+}
+
+static inline void addQuad(MorphContour &contour, const SkPoint &p0, const SkPoint &p1, const SkPoint &p2)
+{
+    addCubic(contour, p0 + (p1 - p0) * (2.0f / 3), p2 + (p1 - p2) * (2.0f / 3), p2);
+}
+
+static inline void addLine(MorphContour &contour, const SkPoint &p0, const SkPoint &p1)
+{
+    addCubic(contour, p0 + (p1 - p0) * (1.0f / 3), p0 + (p1 - p0) * (2.0f / 3), p1);
+}
+
+// Converts every contour of *path* to cubics. Closed contours end with an explicit segment back to their start point.
+static inline std::vector<MorphContour> toCubicContours(const SkPath &path)
+{
+    std::vector<MorphContour> contours;
+    SkPath::Iter iter(path, false);
+    SkPoint pts[4], quads[1 + 2 * 4];
+    for (SkPath::Verb verb; (verb = iter.next(pts)) != SkPath::kDone_Verb;)
+        switch (verb)
+        {
+        case SkPath::kMove_Verb:
+            contours.push_back({{pts[0]}});
+            break;
+        case SkPath::kLine_Verb:
+            addLine(contours.back(), pts[0], pts[1]);
+            break;
+        case SkPath::kQuad_Verb:
+            addQuad(contours.back(), pts[0], pts[1], pts[2]);
+            break;
+        case SkPath::kConic_Verb:
+        {
+            const int count = SkPath::ConvertConicToQuads(pts[0], pts[1], pts[2], iter.conicWeight(), quads, 2);
+            for (int i = 0; i < count; ++i)
+                addQuad(contours.back(), quads[2 * i], quads[2 * i + 1], quads[2 * i + 2]);
+            break;
+        }
+        case SkPath::kCubic_Verb:
+            addCubic(contours.back(), pts[1], pts[2], pts[3]);
+            break;
+        case SkPath::kClose_Verb:
+        {
+            MorphContour &contour = contours.back();
+            if (contour.points.back() != contour.points.front())
+                addLine(contour, contour.points.back(), contour.points.front());
+            contour.closed = true;
+            break;
+        }
+        default:
+            break;
+        }
+    contours.erase(std::remove_if(contours.begin(), contours.end(),
+                                  [](const MorphContour &contour) { return contour.segments() == 0; }),
+                   contours.end());
+    return contours;
+}
+
+static inline SkRect contourBounds(const MorphContour &contour)
+{
+    SkRect bounds;
+    bounds.setBounds(contour.points.data(), contour.points.size());
+    return bounds;
+}
+
+// Splits the cubics of *contour* until it has *count* cubics. Each cubic is split into a number of equal parts that is
+// roughly proportional to its length.
+static inline void resample(MorphContour &contour, size_t count)
+{
+    const size_t segments = contour.segments();
+    if (segments >= count)
+        return;
+    std::vector<SkScalar> lengths(segments);
+    for (size_t i = 0; i < segments; ++i)
+        lengths[i] = cubicLength(contour.cubic(i));
+    const SkScalar total = std::accumulate(lengths.begin(), lengths.end(), 0.0f);
+
+    // Every cubic keeps at least 1 part, and the remaining parts are handed out by the largest remainder.
+    std::vector<size_t> parts(segments, 1);
+    std::vector<std::pair<SkScalar, size_t>> remainders(segments);
+    size_t extra = count - segments, given = 0;
+    for (size_t i = 0; i < segments; ++i)
+    {
+        const SkScalar share = total > 0 ? extra * lengths[i] / total : SkScalar(extra) / segments;
+        parts[i] += static_cast<size_t>(share);
+        given += static_cast<size_t>(share);
+        remainders[i] = {share - std::floor(share), i};
+    }
+    std::sort(remainders.begin(), remainders.end(), std::greater<>());
+    for (size_t i = 0; given < extra; ++i, ++given)
+        ++parts[remainders[i % segments].second];
+
+    std::vector<SkPoint> points{contour.points.front()};
+    points.reserve(3 * count + 1);
+    SkPoint cubic[4], left[4];
+    for (size_t i = 0; i < segments; ++i)
+    {
+        std::copy_n(contour.cubic(i), 4, cubic);
+        for (size_t k = parts[i]; k > 1; --k)
+        {
+            splitCubic(cubic, 1.0f / k, left, cubic);
+            points.insert(points.end(), left + 1, left + 4);
+        }
+        points.insert(points.end(), cubic + 1, cubic + 4);
+    }
+    contour.points = std::move(points);
+}
+
+// Twice the signed area of the polygon through all the points of *contour*.
+static inline SkScalar signedArea(const MorphContour &contour)
+{
+    SkScalar area = 0;
+    const std::vector<SkPoint> &p = contour.points;
+    for (size_t i = 0, j = p.size() - 1; i < p.size(); j = i++)
+        area += p[j].cross(p[i]);
+    return area;
+}
+
+static inline void reverse(MorphContour &contour) { std::reverse(contour.points.begin(), contour.points.end()); }
+
+// Rotates the cubics of the closed contour *contour* so that its segment start points are closest to those of *to*.
+static inline void alignStart(MorphContour &contour, const MorphContour &to)
+{
+    const size_t n = contour.segments();
+    size_t best = 0;
+    SkScalar bestDistance = SK_ScalarInfinity;
+    for (size_t r = 0; r < n; ++r)
+    {
+        SkScalar distance = 0;
+        for (size_t i = 0; i < n && distance < bestDistance; ++i)
+            distance += SkPoint::DistanceToSqd(to.points[3 * i], contour.points[3 * ((i + r) % n)]);
+        if (distance < bestDistance)
+            bestDistance = distance, best = r;
+    }
+    if (best == 0)
+        return;
+    // Drop the start point, which is repeated as the end point, rotate the cubics, and add the new start point.
+    std::vector<SkPoint> &p = contour.points;
+    std::rotate(p.begin() + 1, p.begin() + 1 + 3 * best, p.end());
+    p.front() = p.back();
+}
+
+// Interpolates between two arbitrary paths. The paths are converted to cubics once in the constructor: contours are
+// paired by size, missing contours are added as points, the paired contours are split to the same number of cubics,
+// and closed contours are turned to the same direction with their start points aligned. After that, interpolate()
+// is a single lerp over the points of both paths.
+class PathMorph
+{
+public:
+    PathMorph(const SkPath &start, const SkPath &end)
+        : fStartFillType(start.getFillType()), fEndFillType(end.getFillType())
+    {
+        std::vector<MorphContour> from = toCubicContours(start), to = toCubicContours(end);
+        auto bySize = [](const MorphContour &a, const MorphContour &b)
+        {
+            const SkRect ra = contourBounds(a), rb = contourBounds(b);
+            return ra.width() * ra.height() > rb.width() * rb.height();
+        };
+        std::stable_sort(from.begin(), from.end(), bySize);
+        std::stable_sort(to.begin(), to.end(), bySize);
+        // A missing contour grows from the center of the contour it is paired with.
+        while (from.size() < to.size())
+            from.push_back({{contourBounds(to[from.size()]).center()}, to[from.size()].closed});
+        while (to.size() < from.size())
+            to.push_back({{contourBounds(from[to.size()]).center()}, from[to.size()].closed});
+
+        for (size_t i = 0; i < from.size(); ++i)
+        {
+            MorphContour &a = from[i], &b = to[i];
+            const size_t count = std::max({a.segments(), b.segments(), size_t(1)});
+            for (MorphContour *contour : {&a, &b})
+                if (contour->segments() == 0)
+                    contour->points.assign(3 * count + 1, contour->points.front());
+            resample(a, count);
+            resample(b, count);
+            if (a.closed && b.closed)
+            {
+                if ((signedArea(a) < 0) != (signedArea(b) < 0))
+                    reverse(b);
+                alignStart(b, a);
+            }
+            fContours.push_back({count, a.closed, b.closed});
+            fStart.insert(fStart.end(), a.points.begin(), a.points.end());
+            fEnd.insert(fEnd.end(), b.points.begin(), b.points.end());
+        }
+    }
+
+    // Writes the path at *t* into *dst*, reusing its storage. The points are lerped into *points*, which the caller
+    // owns, so that a morph can be shared by several threads, each with its own buffer.
+    void interpolate(SkScalar t, SkPath &dst, std::vector<SkPoint> &points) const
+    {
+        points.resize(fStart.size());
+        const float *a = reinterpret_cast<const float *>(fStart.data()),
+                    *b = reinterpret_cast<const float *>(fEnd.data());
+        float *out = reinterpret_cast<float *>(points.data());
+        for (size_t i = 0, n = 2 * points.size(); i < n; ++i)
+            out[i] = a[i] + (b[i] - a[i]) * t;
+
+        dst.rewind();
+        dst.setFillType(t < 0.5f ? fStartFillType : fEndFillType);
+        dst.incReserve(points.size());
+        const SkPoint *p = points.data();
+        for (const Contour &contour : fContours)
+        {
+            dst.moveTo(*p++);
+            for (size_t i = 0; i < contour.segments; ++i, p += 3)
+                dst.cubicTo(p[0], p[1], p[2]);
+            if (t < 0.5f ? contour.startClosed : contour.endClosed)
+                dst.close();
+        }
+    }
+
+    size_t countContours() const { return fContours.size(); }
+    size_t countPoints() const { return fStart.size(); }
+
+private:
+    struct Contour
+    {
+        size_t segments;
+        bool startClosed, endClosed;
+    };
+
+    SkPathFillType fStartFillType, fEndFillType;
+    std::vector<Contour> fContours;
+    std::vector<SkPoint> fStart, fEnd;
+};
+
+#endif
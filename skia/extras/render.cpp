@@ -0,0 +1,122 @@
+#include "common.h"
+#include "extras/parallel.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkColorSpace.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkSurface.h"
+#include <pybind11/stl.h>
+
+void initRender(py::module &m)
+{
+    m.def(
+        "renderPictures",
+        [](const std::vector<sk_sp<SkPicture>> &pictures, int width, int height, int workers, const SkColorType &ct,
+           const SkAlphaType &at, const sk_sp<SkColorSpace> &cs)
+        {
+            const SkImageInfo info = SkImageInfo::Make(width, height, ct, at, cs);
+            if (info.isEmpty() || info.bytesPerPixel() == 0)
+                throw py::value_error("Invalid frame size or color type.");
+            for (const sk_sp<SkPicture> &picture : pictures)
+                if (!picture)
+                    throw py::value_error("Pictures must not be None.");
+
+            py::list frames(pictures.size());
+            std::vector<void *> pixels(pictures.size());
+            for (size_t i = 0; i < pictures.size(); ++i)
+            {
+                py::array frame(imageInfoToBufferInfo(info, nullptr, 0, false));
+                pixels[i] = frame.mutable_data();
+                frames[i] = std::move(frame);
+            }
+
+            {
+                py::gil_scoped_release release;
+                workers = resolveWorkers(workers, pictures.size());
+                std::vector<sk_sp<SkSurface>> surfaces(workers);
+                parallelFor(pictures.size(), workers,
+                            [&](int worker, size_t i)
+                            {
+                                sk_sp<SkSurface> &surface = surfaces[worker];
+                                if (!surface)
+                                    surface = SkSurfaces::Raster(info);
+                                if (!surface)
+                                    throw std::runtime_error("Failed to create surface.");
+                                SkCanvas *canvas = surface->getCanvas();
+                                canvas->clear(SK_ColorTRANSPARENT);
+                                canvas->drawPicture(pictures[i]);
+                                if (!surface->readPixels(info, pixels[i], info.minRowBytes(), 0, 0))
+                                    throw std::runtime_error("Failed to read pixels.");
+                            });
+            }
+            return frames;
+        },
+        R"doc(
+            Rasterizes *pictures* in parallel and returns the frames as a list of numpy arrays, in the same order as
+            *pictures*. Each worker thread owns its own raster :py:class:`Surface`, which is cleared to transparent
+            before drawing each picture. The GIL is released while rasterizing.
+
+            :param pictures: The pictures to rasterize.
+            :param width: The width of each frame.
+            :param height: The height of each frame.
+            :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+            :param ct: The color type of the frames.
+            :param at: The alpha type of the frames.
+            :param cs: The color space of the frames.
+            :return: A list of numpy arrays of shape=(height, width, channels).
+        )doc",
+        "pictures"_a, "width"_a, "height"_a, "workers"_a = 0, "ct"_a = SkColorType::kN32_SkColorType,
+        "at"_a = SkAlphaType::kUnpremul_SkAlphaType, "cs"_a = nullptr);
+
+    m.def(
+        "renderPictureTiled",
+        [](const sk_sp<SkPicture> &picture, py::array &array, int tileWidth, int tileHeight, int workers,
+           const SkColorType &ct, const SkAlphaType &at, const sk_sp<SkColorSpace> &cs)
+        {
+            if (!picture)
+                throw py::value_error("Picture must not be None.");
+            if (tileWidth <= 0 || tileHeight <= 0)
+                throw py::value_error("Tile size must be positive.");
+            const SkImageInfo info = ndarrayToImageInfo(array, ct, at, cs);
+            const SkPixmap pixmap(info, array.mutable_data(), array.strides(0));
+            // Dithering depends on the device coordinates modulo 8, so the tiles are aligned to 8 pixels.
+            tileWidth = (tileWidth + 7) & ~7;
+            tileHeight = (tileHeight + 7) & ~7;
+            const int columns = (info.width() + tileWidth - 1) / tileWidth,
+                      rows = (info.height() + tileHeight - 1) / tileHeight;
+
+            py::gil_scoped_release release;
+            parallelFor(static_cast<size_t>(columns) * rows, workers,
+                        [&](int, size_t i)
+                        {
+                            const SkIRect tile = SkIRect::MakeXYWH(i % columns * tileWidth, i / columns * tileHeight,
+                                                                   tileWidth, tileHeight);
+                            SkPixmap subset;
+                            if (!pixmap.extractSubset(&subset, tile))
+                                return;
+                            std::unique_ptr<SkCanvas> canvas = SkCanvas::MakeRasterDirect(
+                                subset.info(), subset.writable_addr(), subset.rowBytes());
+                            if (!canvas)
+                                throw std::runtime_error("Failed to create canvas.");
+                            canvas->translate(-tile.x(), -tile.y());
+                            picture->playback(canvas.get());
+                        });
+        },
+        R"doc(
+            Replays *picture* into *array* in parallel. The array is split into tiles, and each tile is drawn by a
+            worker thread through its own canvas over that part of the array, so the pixels are the same as when
+            playing back the picture on ``Canvas(array)``. The GIL is released while drawing. Recording the picture
+            with :py:class:`RTreeFactory` lets each tile skip the drawing commands outside of it.
+
+            :param picture: The picture to draw.
+            :param array: numpy array of shape=(height, width, channels) and appropriate dtype to draw into.
+            :param tileWidth: The width of each tile, rounded up to a multiple of 8.
+            :param tileHeight: The height of each tile, rounded up to a multiple of 8.
+            :param workers: The number of worker threads. If ``0``, the number of hardware threads is used.
+            :param ct: The color type of the array.
+            :param at: The alpha type of the array.
+            :param cs: The color space of the array.
+        )doc",
+        "picture"_a, "array"_a, "tileWidth"_a = 256, "tileHeight"_a = 256, "workers"_a = 0,
+        "ct"_a = SkColorType::kN32_SkColorType, "at"_a = SkAlphaType::kUnpremul_SkAlphaType, "cs"_a = nullptr);
+}
@@ -0,0 +1,345 @@
+#include "common.h"
+#include "extras/easing.h"
+#include "extras/pathMorph.h"
+#include "include/core/SkColor.h"
+#include "include/core/SkMatrix.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <pybind11/stl.h>
+
+static float srgbToLinear(float c)
+{
+    const float a = std::abs(c);
+    return std::copysign(a <= 0.04045f ? a / 12.92f : std::pow((a + 0.055f) / 1.055f, 2.4f), c);
+}
+
+static float linearToSrgb(float c)
+{
+    const float a = std::abs(c);
+    return std::copysign(a <= 0.0031308f ? a * 12.92f : 1.055f * std::pow(a, 1 / 2.4f) - 0.055f, c);
+}
+
+// Converts the linear sRGB color *c* to OKLab in place.
+static void linearToOklab(float c[3])
+{
+    const float l = std::cbrt(0.4122214708f * c[0] + 0.5363325363f * c[1] + 0.0514459929f * c[2]),
+                m = std::cbrt(0.2119034982f * c[0] + 0.6806995451f * c[1] + 0.1073969566f * c[2]),
+                s = std::cbrt(0.0883024619f * c[0] + 0.2817188376f * c[1] + 0.6299787005f * c[2]);
+    c[0] = 0.2104542553f * l + 0.7936177850f * m - 0.0040720468f * s;
+    c[1] = 1.9779984951f * l - 2.4285922050f * m + 0.4505937099f * s;
+    c[2] = 0.0259040371f * l + 0.7827717662f * m - 0.8086757660f * s;
+}
+
+// Converts the OKLab color *c* to linear sRGB in place.
+static void oklabToLinear(float c[3])
+{
+    float l = c[0] + 0.3963377774f * c[1] + 0.2158037573f * c[2],
+          m = c[0] - 0.1055613458f * c[1] - 0.0638541728f * c[2],
+          s = c[0] - 0.0894841775f * c[1] - 1.2914855480f * c[2];
+    l = l * l * l, m = m * m * m, s = s * s * s;
+    c[0] = 4.0767416621f * l - 3.3077115913f * m + 0.2309699292f * s;
+    c[1] = -1.2684380046f * l + 2.6097574011f * m - 0.3413193965f * s;
+    c[2] = -0.0041960863f * l - 0.7034186147f * m + 1.7076147010f * s;
+}
+
+// A set of tracks of keyframes. Each keyframe has an easing, which is used for the segment that ends at it. Colors are
+// stored in the space they are interpolated in, and paths keep a PathMorph for each pair of consecutive keyframes, so
+// evaluate() only searches for the segment of each track and lerps. evaluate() doesn't modify the timeline, so it is a
+// pure function of the time and can be called from several threads.
+class Timeline
+{
+public:
+    enum class TrackType
+    {
+        kScalar,
+        kPoint,
+        kColor,
+        kMatrix,
+        kPath,
+    };
+
+    enum class ColorSpace
+    {
+        kSRGB,
+        kLinearSRGB,
+        kOKLab,
+    };
+
+    size_t addTrack(TrackType type, ColorSpace space)
+    {
+        static constexpr int kComponents[] = {1, 2, 4, 9, 0};
+        Track track{type, space, kComponents[static_cast<int>(type)], fValueCount};
+        fValueCount += track.components;
+        fTracks.push_back(std::move(track));
+        return fTracks.size() - 1;
+    }
+
+    // Adds a keyframe with the numeric *values* to *track*. Keyframes at the same time are kept in the order they were
+    // added, which makes the value jump at that time.
+    void addKeyframe(size_t track, float time, const float *values, const Easing &easing)
+    {
+        Track &t = this->track(track);
+        const size_t i = insertTime(t, time, easing);
+        float *v = &*t.values.insert(t.values.begin() + i * t.components, values, values + t.components);
+        if (t.type == TrackType::kColor && t.space != ColorSpace::kSRGB)
+        {
+            for (int k = 0; k < 3; ++k)
+                v[k] = srgbToLinear(v[k]);
+            if (t.space == ColorSpace::kOKLab)
+                linearToOklab(v);
+        }
+    }
+
+    void addKeyframe(size_t track, float time, const SkPath &path, const Easing &easing)
+    {
+        Track &t = this->track(track);
+        const size_t i = insertTime(t, time, easing), count = t.paths.size();
+        t.paths.insert(t.paths.begin() + i, path);
+
+        // The morph that spanned the new keyframe is replaced by the morphs to and from it.
+        std::vector<std::unique_ptr<const PathMorph>> morphs;
+        if (i > 0)
+            morphs.push_back(std::make_unique<const PathMorph>(t.paths[i - 1], t.paths[i]));
+        if (i < count)
+            morphs.push_back(std::make_unique<const PathMorph>(t.paths[i], t.paths[i + 1]));
+        if (i > 0 && i < count)
+            t.morphs.erase(t.morphs.begin() + i - 1);
+        t.morphs.insert(t.morphs.begin() + (i > 0 ? i - 1 : 0), std::make_move_iterator(morphs.begin()),
+                        std::make_move_iterator(morphs.end()));
+    }
+
+    // Evaluates every track at *time*. The numeric values are written to *values*, at the offset of each track, and the
+    // paths to *paths*, at the index of each track. Tracks without keyframes are skipped.
+    void evaluate(float time, float *values, SkPath *paths) const
+    {
+        std::vector<SkPoint> scratch;
+        for (size_t k = 0; k < fTracks.size(); ++k)
+        {
+            const Track &t = fTracks[k];
+            if (t.times.empty())
+                continue;
+            size_t i;
+            float u;
+            segment(t, time, i, u);
+            if (t.type == TrackType::kPath)
+            {
+                if (u == 0)
+                    paths[k] = t.paths[i];
+                else
+                    t.morphs[i]->interpolate(u, paths[k], scratch);
+                continue;
+            }
+
+            float *out = values + t.offset;
+            const float *a = &t.values[i * t.components];
+            if (u == 0)
+                std::copy_n(a, t.components, out);
+            else
+                for (int c = 0; c < t.components; ++c)
+                    out[c] = a[c] + (a[c + t.components] - a[c]) * u;
+            if (t.type == TrackType::kColor)
+            {
+                if (t.space == ColorSpace::kOKLab)
+                    oklabToLinear(out);
+                if (t.space != ColorSpace::kSRGB)
+                    for (int c = 0; c < 3; ++c)
+                        out[c] = linearToSrgb(out[c]);
+                for (int c = 0; c < 4; ++c)
+                    out[c] = SkTPin(out[c], 0.0f, 1.0f);
+            }
+        }
+    }
+
+    size_t countTracks() const { return fTracks.size(); }
+    size_t countKeyframes(size_t track) const { return this->track(track).times.size(); }
+    size_t countValues() const { return fValueCount; }
+    TrackType trackType(size_t track) const { return this->track(track).type; }
+    size_t trackOffset(size_t track) const { return this->track(track).offset; }
+
+    // The time of the last keyframe of all tracks.
+    float duration() const
+    {
+        float duration = 0;
+        for (const Track &t : fTracks)
+            if (!t.times.empty())
+                duration = std::max(duration, t.times.back());
+        return duration;
+    }
+
+private:
+    struct Track
+    {
+        TrackType type;
+        ColorSpace space;
+        int components;
+        size_t offset;
+        std::vector<float> times;
+        std::vector<Easing> easings;
+        std::vector<float> values;
+        std::vector<SkPath> paths;
+        std::vector<std::unique_ptr<const PathMorph>> morphs;
+    };
+
+    std::vector<Track> fTracks;
+    size_t fValueCount = 0;
+
+    Track &track(size_t track)
+    {
+        if (track >= fTracks.size())
+            throw py::index_error("Track index out of range.");
+        return fTracks[track];
+    }
+    const Track &track(size_t track) const { return const_cast<Timeline *>(this)->track(track); }
+
+    static size_t insertTime(Track &t, float time, const Easing &easing)
+    {
+        if (!std::isfinite(time))
+            throw py::value_error("Keyframe time must be finite.");
+        const size_t i = std::upper_bound(t.times.begin(), t.times.end(), time) - t.times.begin();
+        t.times.insert(t.times.begin() + i, time);
+        t.easings.insert(t.easings.begin() + i, easing);
+        return i;
+    }
+
+    // Finds the keyframe *i* at which the segment containing *time* starts, and the eased progress *u* in it. Before
+    // the first and after the last keyframe, *u* is 0 and the value is held.
+    static void segment(const Track &t, float time, size_t &i, float &u)
+    {
+        const size_t next = std::upper_bound(t.times.begin(), t.times.end(), time) - t.times.begin();
+        u = 0;
+        if (next == 0)
+        {
+            i = 0;
+            return;
+        }
+        i = next - 1;
+        if (next == t.times.size())
+            return;
+        u = t.easings[next]((time - t.times[i]) / (t.times[next] - t.times[i]));
+    }
+};
+
+void initTimeline(py::module &m)
+{
+    py::class_<Timeline> timeline(m, "Timeline", R"doc(
+        A set of tracks of keyframes, which are all evaluated at once in native code. A track animates a scalar, a
+        :py:class:`Point`, a :py:class:`Color4f`, a :py:class:`Matrix` or a :py:class:`Path`. Each keyframe has an
+        :py:class:`Easing` for the segment that ends at it. Colors can be interpolated in sRGB, linear sRGB or OKLab,
+        and paths are interpolated with a :py:class:`PathMorph` for each pair of consecutive keyframes. Before the
+        first and after the last keyframe of a track, its value is held.
+
+        :py:meth:`evaluate` doesn't modify the timeline, so the values only depend on the time, and frames can be
+        evaluated in any order, from any thread.
+    )doc");
+
+    py::enum_<Timeline::TrackType>(timeline, "TrackType")
+        .value("kScalar", Timeline::TrackType::kScalar)
+        .value("kPoint", Timeline::TrackType::kPoint)
+        .value("kColor", Timeline::TrackType::kColor)
+        .value("kMatrix", Timeline::TrackType::kMatrix)
+        .value("kPath", Timeline::TrackType::kPath);
+
+    py::enum_<Timeline::ColorSpace>(timeline, "ColorSpace")
+        .value("kSRGB", Timeline::ColorSpace::kSRGB)
+        .value("kLinearSRGB", Timeline::ColorSpace::kLinearSRGB)
+        .value("kOKLab", Timeline::ColorSpace::kOKLab);
+
+    timeline.def(py::init())
+        .def("addTrack", &Timeline::addTrack,
+             R"doc(
+                Adds an empty track and returns its index.
+
+                :param type: The type of the values of the track.
+                :param space: The color space colors are interpolated in. Ignored by other tracks.
+            )doc",
+             "type"_a, "space"_a = Timeline::ColorSpace::kSRGB)
+        .def(
+            "addKeyframe",
+            [](Timeline &self, size_t track, float time, const py::object &value, const std::optional<Easing> &easing)
+            {
+                const Easing ease = easing.value_or(Easing(Easing::Type::kLinear, 0, 0));
+                float values[9];
+                switch (self.trackType(track))
+                {
+                case Timeline::TrackType::kScalar:
+                    values[0] = value.cast<float>();
+                    break;
+                case Timeline::TrackType::kPoint:
+                {
+                    const SkPoint point = value.cast<SkPoint>();
+                    values[0] = point.fX, values[1] = point.fY;
+                    break;
+                }
+                case Timeline::TrackType::kColor:
+                {
+                    const SkColor4f color = value.cast<SkColor4f>();
+                    std::copy_n(color.vec(), 4, values);
+                    break;
+                }
+                case Timeline::TrackType::kMatrix:
+                    value.cast<SkMatrix>().get9(values);
+                    break;
+                case Timeline::TrackType::kPath:
+                    self.addKeyframe(track, time, value.cast<SkPath>(), ease);
+                    return;
+                }
+                self.addKeyframe(track, time, values, ease);
+            },
+            R"doc(
+                Adds a keyframe to *track*. Keyframes can be added in any order. Keyframes at the same time are kept in
+                the order they were added, so the value jumps at that time.
+
+                :param track: The index of the track.
+                :param time: The time of the keyframe.
+                :param value: The value at *time*, a float, :py:class:`Point`, :py:class:`Color4f`, :py:class:`Matrix`
+                    or :py:class:`Path` depending on the type of the track.
+                :param easing: The easing of the segment from the previous keyframe to this one. Linear if ``None``.
+            )doc",
+            "track"_a, "time"_a, "value"_a, "easing"_a = py::none())
+        .def(
+            "evaluate",
+            [](const Timeline &self, float time)
+            {
+                std::vector<float> values(self.countValues());
+                std::vector<SkPath> paths(self.countTracks());
+                {
+                    py::gil_scoped_release release;
+                    self.evaluate(time, values.data(), paths.data());
+                }
+                py::list result(self.countTracks());
+                for (size_t i = 0; i < self.countTracks(); ++i)
+                {
+                    const float *v = values.data() + self.trackOffset(i);
+                    SkMatrix matrix;
+                    switch (self.countKeyframes(i) ? self.trackType(i) : Timeline::TrackType::kPath)
+                    {
+                    case Timeline::TrackType::kScalar:
+                        result[i] = py::float_(v[0]);
+                        break;
+                    case Timeline::TrackType::kPoint:
+                        result[i] = py::cast(SkPoint::Make(v[0], v[1]));
+                        break;
+                    case Timeline::TrackType::kColor:
+                        result[i] = py::cast(SkColor4f{v[0], v[1], v[2], v[3]});
+                        break;
+                    case Timeline::TrackType::kMatrix:
+                        result[i] = py::cast(matrix.set9(v));
+                        break;
+                    case Timeline::TrackType::kPath:
+                        result[i] = self.countKeyframes(i) ? py::cast(std::move(paths[i])) : py::none();
+                        break;
+                    }
+                }
+                return result;
+            },
+            R"doc(
+                Evaluates every track at *time* and returns the values as a list, in the order of the tracks. The value
+                of a track without keyframes is ``None``. The GIL is released while evaluating.
+            )doc",
+            "time"_a)
+        .def("countTracks", &Timeline::countTracks)
+        .def("countKeyframes", &Timeline::countKeyframes, "track"_a)
+        .def("trackType", &Timeline::trackType, "track"_a)
+        .def("duration", &Timeline::duration, "Returns the time of the last keyframe of all tracks.");
+}
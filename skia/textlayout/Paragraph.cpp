@@ -195,8 +195,9 @@ void initParagraph(py::module &m)
         .def("getIdeographicBaseline", &Paragraph::getIdeographicBaseline)
         .def("getLongestLine", &Paragraph::getLongestLine)
         .def("didExceedMaxLines", &Paragraph::didExceedMaxLines)
-        .def("layout", &Paragraph::layout, "width"_a)
-        .def("paint", py::overload_cast<SkCanvas *, SkScalar, SkScalar>(&Paragraph::paint), "canvas"_a, "x"_a, "y"_a)
+        .def("layout", &Paragraph::layout, "width"_a, ReleaseGIL())
+        .def("paint", py::overload_cast<SkCanvas *, SkScalar, SkScalar>(&Paragraph::paint), "canvas"_a, "x"_a, "y"_a,
+             ReleaseGIL())
         .def("getRectsForRange", &Paragraph::getRectsForRange, "start"_a, "end"_a, "rectHeightStyle"_a,
              "rectWidthStyle"_a)
         .def("getRectsForPlaceholders", &Paragraph::getRectsForPlaceholders)
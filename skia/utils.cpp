@@ -18,6 +18,15 @@ SkImageInfo ndarrayToImageInfo(const py::array &array, const SkColorType &ct, co
     return info;
 }
 
+size_t ndarrayRows(const py::array &array, py::ssize_t columns, const char *name)
+{
+    if (columns == 1 && array.ndim() != 1)
+        throw py::value_error("{} must be a 1-dimensional array."_s.format(name));
+    if (columns > 1 && (array.ndim() != 2 || array.shape(1) != columns))
+        throw py::value_error("{} must be an array of shape (N, {})."_s.format(name, columns));
+    return array.shape(0);
+}
+
 size_t validateImageInfo_Buffer(const SkImageInfo &imgInfo, const py::buffer_info &bufInfo, size_t rowBytes)
 {
     if (rowBytes == 0)
@@ -0,0 +1,22 @@
+"""Shared fixtures of the tests."""
+from typing import Callable
+
+import pytest
+
+from animator import Scene, skia
+
+
+@pytest.fixture
+def make_scene() -> Callable[..., Scene]:
+    """Returns a factory of 200x100 scenes with a black background. The scenes draw in RGBA order on every platform,
+    so channel 0 of their frames is red and channel 2 is blue. Keyword arguments are set as attributes of the scene,
+    like ``make_scene(occlusion_culling=True)``."""
+
+    def make(**attributes) -> Scene:
+        scene = Scene(200, 100, color_type=skia.ColorType.kRGBA_8888_ColorType)
+        scene.bgcolor = skia.Color4f.kBlack
+        for name, value in attributes.items():
+            setattr(scene, name, value)
+        return scene
+
+    return make
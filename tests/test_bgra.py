@@ -0,0 +1,87 @@
+"""Channel order of the frames of a BGRA scene, as drawn, saved, rendered and exported."""
+import stat
+import sys
+from pathlib import Path
+
+import cv2
+import numpy as np
+
+from animator import Rect, Scene, processing, skia
+
+BGRA = skia.ColorType.kBGRA_8888_ColorType
+_RED_BGRA = [0, 0, 255, 255]
+
+
+def _red_rect_scene() -> Scene:
+    scene = Scene(40, 20, color_type=BGRA)
+    scene.bgcolor = skia.Color4f.kBlack
+    scene.add(Rect(10, pos=(5, 5), fill_color='red', style='fill'))
+    return scene
+
+
+def _read(path: Path) -> np.ndarray:
+    image = cv2.imread(str(path), cv2.IMREAD_UNCHANGED)  # decoded as BGRA
+    assert image is not None, path
+    return image
+
+
+def _assert_red_rect(bgra: np.ndarray) -> None:
+    np.testing.assert_array_equal(bgra[10, 10], _RED_BGRA)
+    np.testing.assert_array_equal(bgra[2, 30], [0, 0, 0, 255])
+
+
+def test_frame_is_stored_in_bgra_order() -> None:
+    scene = _red_rect_scene()
+    scene.update()
+    _assert_red_rect(scene.frame)
+
+
+def test_save_frame(tmp_path: Path) -> None:
+    scene = _red_rect_scene()
+    scene.update()
+    scene.save_frame(str(tmp_path / 'frame.png'))
+    _assert_red_rect(_read(tmp_path / 'frame.png'))
+
+
+def test_save_frames(tmp_path: Path) -> None:
+    assert _red_rect_scene().save_frames(str(tmp_path / 'frame{}.png'), 2, workers=1) == 2
+    for path in sorted(tmp_path.glob('frame*.png')):
+        _assert_red_rect(_read(path))
+
+
+def test_render() -> None:
+    frames = list(_red_rect_scene().render(2, workers=1))
+    assert len(frames) == 2
+    for frame in frames:
+        _assert_red_rect(frame)
+
+
+def test_export_video_declares_bgra_input(tmp_path: Path) -> None:
+    script = tmp_path / 'fake_encoder'
+    script.write_text(
+        f'#!{sys.executable}\n'
+        'import shutil, sys\n'
+        'open(sys.argv[-1] + ".args", "w").write("\\n".join(sys.argv[1:]))\n'
+        'with open(sys.argv[-1], "wb") as f:\n'
+        '    shutil.copyfileobj(sys.stdin.buffer, f)\n'
+    )
+    script.chmod(script.stat().st_mode | stat.S_IXUSR)
+    output = tmp_path / 'out.raw'
+    scene = _red_rect_scene()
+    assert scene.export_video(str(output), 1, ffmpeg=str(script)) == 1
+
+    args = (tmp_path / 'out.raw.args').read_text().split('\n')
+    assert args[args.index('-pix_fmt') + 1] == 'bgra'  # the first one describes the input
+    _assert_red_rect(np.fromfile(output, np.uint8).reshape(scene.frame.shape))
+
+
+def test_processing_sketch_saves_red_as_red(tmp_path: Path) -> None:
+    processing.size(40, 20)
+    assert processing._get_scene().color_type == BGRA
+    processing.background(0)
+    processing.noStroke()
+    processing.fill(255, 0, 0)
+    processing.rect(5, 5, 10, 10)
+    _assert_red_rect(processing._get_scene().frame)
+    processing.save(str(tmp_path / 'sketch.png'))
+    _assert_red_rect(_read(tmp_path / 'sketch.png'))
@@ -0,0 +1,117 @@
+"""NumPy overloads of the :class:`skia.Canvas` draw calls, compared with their list overloads."""
+from typing import Callable
+
+import numpy as np
+import pytest
+
+from animator import skia
+from animator.graphics import FontStyle
+
+RGBA = skia.ColorType.kRGBA_8888_ColorType
+_POINTS = np.array([[5, 5], [40, 10], [20, 35], [55, 30]], np.float32)
+
+
+def _draw(draw: Callable[[skia.Canvas], None]) -> np.ndarray:
+    frame = np.zeros((40, 60, 4), np.uint8)
+    draw(skia.Canvas(frame, RGBA))
+    return frame
+
+
+def _assert_same(array_draw: Callable[[skia.Canvas], None], list_draw: Callable[[skia.Canvas], None]) -> None:
+    expected = _draw(list_draw)
+    assert expected.any(), 'the list overload drew nothing'
+    np.testing.assert_array_equal(_draw(array_draw), expected)
+
+
+def _xforms(count: int) -> np.ndarray:
+    angles = np.linspace(0, np.pi / 3, count, dtype=np.float32)
+    return np.stack([np.cos(angles), np.sin(angles), 8 + 12 * np.arange(count), np.full(count, 25)], 1).astype(
+        np.float32
+    )
+
+
+@pytest.mark.parametrize('mode', list(skia.Canvas.PointMode.__members__.values()))
+def test_draw_points(mode: skia.Canvas.PointMode) -> None:
+    paint = skia.Paint(color=skia.ColorRED, strokeWidth=3)
+    points = [skia.Point(*p) for p in _POINTS.tolist()]
+    _assert_same(lambda c: c.drawPoints(mode, _POINTS, paint), lambda c: c.drawPoints(mode, points, paint))
+
+
+@pytest.fixture
+def glyphs() -> tuple[np.ndarray, skia.Font]:
+    font = skia.Font(FontStyle.get_font(None), 16)
+    ids = np.array(font.textToGlyphs('Ship'), np.uint16)
+    if not ids.all():
+        pytest.skip('no font with these glyphs is available')
+    return ids, font
+
+
+def test_draw_glyphs_with_positions(glyphs: tuple[np.ndarray, skia.Font]) -> None:
+    ids, font = glyphs
+    positions = np.stack([6 + 12 * np.arange(len(ids)), np.full(len(ids), 20)], 1).astype(np.float32)
+    points = [skia.Point(*p) for p in positions.tolist()]
+    paint, origin = skia.Paint(color=skia.ColorRED), skia.Point(2, 5)
+    _assert_same(
+        lambda c: c.drawGlyphs(ids, positions, origin, font, paint),
+        lambda c: c.drawGlyphs(ids.tolist(), points, origin, font, paint),
+    )
+
+
+def test_draw_glyphs_with_xforms(glyphs: tuple[np.ndarray, skia.Font]) -> None:
+    ids, font = glyphs
+    xforms = _xforms(len(ids))
+    rsxforms = [skia.RSXform(*x) for x in xforms.tolist()]
+    paint, origin = skia.Paint(color=skia.ColorRED), skia.Point(2, 5)
+    _assert_same(
+        lambda c: c.drawGlyphs(ids, xforms, origin, font, paint),
+        lambda c: c.drawGlyphs(ids.tolist(), rsxforms, origin, font, paint),
+    )
+    # the same numbers read as positions would place the glyphs elsewhere
+    positions = [skia.Point(x[2], x[3]) for x in xforms.tolist()]
+    rotated = _draw(lambda c: c.drawGlyphs(ids, xforms, origin, font, paint))
+    assert not np.array_equal(rotated, _draw(lambda c: c.drawGlyphs(ids.tolist(), positions, origin, font, paint)))
+
+
+def test_draw_glyphs_rejects_bad_shapes(glyphs: tuple[np.ndarray, skia.Font]) -> None:
+    ids, font = glyphs
+    canvas, paint = skia.Canvas(np.zeros((4, 4, 4), np.uint8), RGBA), skia.Paint()
+    with pytest.raises(ValueError):
+        canvas.drawGlyphs(ids, np.zeros((len(ids), 3), np.float32), skia.Point(0, 0), font, paint)
+    with pytest.raises(ValueError):
+        canvas.drawGlyphs(ids, np.zeros((len(ids) + 1, 2), np.float32), skia.Point(0, 0), font, paint)
+
+
+def test_draw_patch() -> None:
+    top = [[5, 5], [20, 0], [40, 10], [55, 5]]
+    right = [[50, 15], [58, 25]]
+    bottom = [[55, 35], [40, 30], [20, 40], [5, 35]]
+    left = [[10, 25], [0, 15]]
+    cubics = np.array(top + right + bottom + left, np.float32)
+    colors = np.array([0xFFFF0000, 0xFF00FF00, 0xFF0000FF, 0xFFFFFFFF], np.uint32)
+    points = [skia.Point(*p) for p in cubics.tolist()]
+    paint, mode = skia.Paint(), skia.BlendMode.kModulate
+    _assert_same(
+        lambda c: c.drawPatch(cubics, colors, None, mode, paint),
+        lambda c: c.drawPatch(points, colors.tolist(), None, mode, paint),
+    )
+
+
+def test_draw_atlas() -> None:
+    pixels = np.zeros((8, 16, 4), np.uint8)
+    pixels[:, :8] = [255, 0, 0, 255]
+    pixels[:, 8:] = [0, 0, 255, 255]
+    atlas = skia.Image.fromarray(pixels, RGBA)
+    tex = np.array([[0, 0, 8, 8], [8, 0, 16, 8], [0, 0, 16, 8]], np.float32)
+    xforms = _xforms(len(tex))
+    colors = np.array([0xFFFFFFFF, 0xFF00FF00, 0x80FFFFFF], np.uint32)
+    rects = [skia.Rect(*r) for r in tex.tolist()]
+    rsxforms = [skia.RSXform(*x) for x in xforms.tolist()]
+    mode, sampling = skia.BlendMode.kModulate, skia.SamplingOptions()
+    _assert_same(
+        lambda c: c.drawAtlas(atlas, xforms, tex, colors, mode, sampling),
+        lambda c: c.drawAtlas(atlas, rsxforms, rects, colors.tolist(), mode, sampling),
+    )
+    _assert_same(
+        lambda c: c.drawAtlas(atlas, None, tex, None, mode, sampling),
+        lambda c: c.drawAtlas(atlas, None, rects, None, mode, sampling),
+    )
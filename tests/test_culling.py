@@ -0,0 +1,78 @@
+"""Culling when the bounds of entities change."""
+from typing import Callable
+
+from animator import Group, Rect, Scene, SimpleText, skia
+
+
+def test_text_set_after_creation_is_drawn(make_scene: Callable[..., Scene]) -> None:
+    scene = make_scene()
+    text = SimpleText('', pos=(20, 60))
+    scene.add(text)
+    scene.update()
+    assert scene.culled_count == 0
+    text.text = 'Hello'
+    scene.update()
+    assert scene.drawn_count == 1 and scene.culled_count == 0
+    assert scene.frame[..., :3].any()
+
+
+def test_text_bounds_follow_font_changes() -> None:
+    text = SimpleText('Hello', pos=(0, 0))
+    small = skia.Rect(text.world_bounds)
+    text.font_style.size = small.height() * 4
+    assert text.world_bounds.height() > small.height()
+
+
+def test_entity_moved_back_into_view_is_drawn(make_scene: Callable[..., Scene]) -> None:
+    scene = make_scene()
+    rect = Rect(20, pos=(500, 500))
+    scene.add(rect)
+    scene.update()
+    assert scene.culled_count == 1 and scene.drawn_count == 0
+    rect.pos.set(50, 50)
+    scene.update()
+    assert scene.culled_count == 0 and scene.drawn_count == 1
+    assert scene.frame[50:70, 50:70, :3].any()
+
+
+def test_resized_entity_is_not_culled(make_scene: Callable[..., Scene]) -> None:
+    scene = make_scene()
+    rect = Rect(10, pos=(-100, 10))
+    scene.add(rect)
+    scene.update()
+    assert scene.culled_count == 1
+    rect.w = 150
+    scene.update()
+    assert scene.culled_count == 0
+    assert scene.frame[10:20, 0:40, :3].any()
+
+
+def test_path_edited_in_place_is_drawn(make_scene: Callable[..., Scene]) -> None:
+    scene = make_scene()
+    rect = Rect(10, pos=(10, 10), fill_color='red', style='fill')
+    scene.add(rect)
+    scene.update()
+    assert not scene.frame[50:70, 150:170, :3].any()
+    rect.path.addRect(skia.Rect.MakeXYWH(140, 40, 20, 20))
+    scene.update()
+    assert scene.drawn_count == 1
+    assert scene.frame[50:70, 150:170, :3].any()
+
+
+def test_moving_the_root_of_a_deep_chain_moves_the_leaf(make_scene: Callable[..., Scene]) -> None:
+    scene = make_scene()
+    root = Group(pos=(0, 0))
+    parent = root
+    for _ in range(50):
+        child = Group(pos=(1, 0))
+        parent.add(child)
+        parent = child
+    leaf = Rect(10, pos=(0, 10))
+    parent.add(leaf)
+    scene.add(root)
+    scene.update()
+    assert scene.frame[10:20, 50:60, :3].any()
+    root.pos.set(100, 0)
+    scene.update()
+    assert not scene.frame[10:20, 50:60, :3].any() and scene.frame[10:20, 150:160, :3].any()
+    assert leaf.absolute_position.fX == 150
@@ -0,0 +1,127 @@
+"""The native easing functions against the pure Python formulas they replaced."""
+import math
+from typing import Callable
+
+import numpy as np
+import pytest
+
+from animator import skia
+from animator.anim import easing
+
+T = [i / 64 for i in range(65)]
+
+
+def _bounce_out(t: float) -> float:
+    if t < 1 / 2.75:
+        return 7.5625 * t * t
+    if t < 2 / 2.75:
+        return 7.5625 * (t - 1.5 / 2.75) ** 2 + 0.75
+    if t < 2.5 / 2.75:
+        return 7.5625 * (t - 2.25 / 2.75) ** 2 + 0.9375
+    return 7.5625 * (t - 2.625 / 2.75) ** 2 + 0.984375
+
+
+def _pow_inout(n: float) -> Callable[[float], float]:
+    def f(t: float) -> float:
+        t *= 2
+        if t < 1:
+            return t**n * 0.5
+        return 1 - abs((2 - t) ** n) * 0.5
+
+    return f
+
+
+def _back_inout(amount: float) -> Callable[[float], float]:
+    def f(t: float) -> float:
+        t *= 2
+        if t < 1:
+            return t * t * ((amount + 1) * t - amount) * 0.5
+        t -= 2
+        return t * t * ((amount + 1) * t + amount) * 0.5 + 1
+
+    return f
+
+
+def _elastic_out(amplitude: float, period: float) -> Callable[[float], float]:
+    asin = math.asin(1 / amplitude)
+    period = math.tau / period
+
+    def f(t: float) -> float:
+        if t == 0 or t == 1:
+            return t
+        return amplitude * 2 ** (-10 * t) * math.sin(t * period - asin) + 1
+
+    return f
+
+
+def _elastic_inout(amplitude: float, period: float) -> Callable[[float], float]:
+    asin = math.asin(1 / amplitude)
+    period = math.tau / period
+
+    def f(t: float) -> float:
+        t = t * 2 - 1
+        if t < 0:
+            return -0.5 * amplitude * 2 ** (10 * t) * math.sin(t * period - asin)
+        return amplitude * 2 ** (-10 * t) * math.sin(t * period - asin) * 0.5 + 1
+
+    return f
+
+
+REFERENCES: list[tuple[skia.Easing, Callable[[float], float]]] = [
+    (easing.linear, lambda t: t),
+    (easing.sin_in, lambda t: 1 - math.cos(t * math.pi / 2)),
+    (easing.sin_out, lambda t: math.sin(t * math.pi / 2)),
+    (easing.sin_inout, lambda t: (1 - math.cos(t * math.pi)) * 0.5),
+    (easing.circ_in, lambda t: 1 - math.sqrt(1 - t * t)),
+    (easing.circ_out, lambda t: math.sqrt(t * (2 - t))),
+    (easing.exp_in, lambda t: 2 ** (10 * (t - 1))),
+    (easing.exp_out, lambda t: 1 - 2 ** (-10 * t)),
+    (easing.bounce_in, lambda t: 1 - _bounce_out(1 - t)),
+    (easing.bounce_out, _bounce_out),
+    (easing.get_quadish(0.5), lambda t: t * (1 + (1 - t) * 0.5)),
+    (easing.cubic_in, lambda t: t**3),
+    (easing.quart_out, lambda t: 1 - (1 - t) ** 4),
+    (easing.quint_inout, _pow_inout(5)),
+    (easing.back_in, lambda t: t * t * (2.70158 * t - 1.70158)),
+    (easing.back_inout, _back_inout(1.70158)),
+    (easing.elastic_out, _elastic_out(1, 0.3)),
+    (easing.elastic_inout, _elastic_inout(1, 0.45)),
+]
+
+
+@pytest.mark.parametrize('native, reference', REFERENCES)
+def test_matches_python_formula(native: skia.Easing, reference: Callable[[float], float]) -> None:
+    for t in T:
+        assert native(t) == pytest.approx(reference(t), abs=1e-5), t
+
+
+@pytest.mark.parametrize('native, reference', REFERENCES)
+def test_array_matches_scalar(native: skia.Easing, reference: Callable[[float], float]) -> None:
+    t = np.array(T, dtype=np.float32).reshape(5, 13)
+    result = native(t)
+    assert result.shape == t.shape and result.dtype == np.float32
+    np.testing.assert_allclose(result.ravel(), [native(x) for x in T], atol=1e-6)
+
+
+def test_out_in_place() -> None:
+    t = np.array(T, dtype=np.float32)
+    expected = easing.bounce_out(t)
+    assert easing.bounce_out(t, out=t) is not None
+    np.testing.assert_array_equal(t, expected)
+
+
+@pytest.mark.parametrize('t', [np.float32(0.25), np.float64(0.25), np.array(0.25), 0.25, 0])
+def test_scalars_return_float(t: object) -> None:
+    result = easing.cubic_in(t)
+    assert type(result) is float
+    assert result == pytest.approx(float(t) ** 3)
+
+
+def test_bezier_endpoints_and_linear() -> None:
+    ease = easing.bezier(0.42, 0, 0.58, 1)
+    assert ease(0) == pytest.approx(0, abs=1e-5)
+    assert ease(1) == pytest.approx(1, abs=1e-5)
+    assert ease(0.5) == pytest.approx(0.5, abs=1e-4)
+    line = easing.bezier(1 / 3, 1 / 3, 2 / 3, 2 / 3)
+    for t in T:
+        assert line(t) == pytest.approx(t, abs=1e-4)
@@ -0,0 +1,123 @@
+"""Ordering of :class:`EntityList` by z-index."""
+import pytest
+
+from animator import Entity
+from animator.entity.entity_list import EntityList
+
+
+def _entities(n: int) -> list[Entity]:
+    return [Entity() for _ in range(n)]
+
+
+def test_equal_z_index_keeps_insertion_order() -> None:
+    entities = _entities(5)
+    lst = EntityList()
+    lst.extend(entities)
+    assert list(lst) == entities
+
+
+def test_sorted_by_z_index_and_stable() -> None:
+    a, b, c, d = _entities(4)
+    a.z_index = 2
+    c.z_index = -1
+    lst = EntityList()
+    for e in (a, b, c, d):
+        lst.append(e)
+    assert list(lst) == [c, b, d, a]
+
+
+def test_z_index_change_resorts() -> None:
+    a, b, c = _entities(3)
+    lst = EntityList()
+    lst.extend((a, b, c))
+    a.z_index = 1
+    assert list(lst) == [b, c, a]
+    a.z_index = 0
+    assert list(lst) == [a, b, c]
+    c.z_index = -1
+    assert lst[0] is c and list(reversed(lst)) == [b, a, c]
+
+
+def test_remove_and_pop() -> None:
+    a, b, c = _entities(3)
+    lst = EntityList()
+    lst.extend((a, b, c))
+    lst.remove(b)
+    assert list(lst) == [a, c] and b not in lst
+    b.z_index = 5  # no longer tracked
+    assert lst.pop() is c
+    assert list(lst) == [a] and c not in lst
+
+
+def test_clear_unregisters_entities() -> None:
+    a, b = _entities(2)
+    lst = EntityList()
+    lst.extend((a, b))
+    lst.clear()
+    assert len(lst) == 0 and a not in lst
+    assert not a._entity_lists and not b._entity_lists
+
+
+def test_duplicates() -> None:
+    a, b = _entities(2)
+    lst = EntityList()
+    lst.extend((a, b, a))
+    assert list(lst) == [a, a, b]
+    lst.remove(a)
+    assert list(lst) == [a, b] and a in lst
+    a.z_index = 1
+    assert list(lst) == [b, a]
+    lst.clear()
+    assert not a._entity_lists
+
+
+def test_entity_in_several_lists() -> None:
+    a, b = _entities(2)
+    first, second = EntityList(), EntityList()
+    first.extend((a, b))
+    second.extend((b, a))
+    a.z_index = 1
+    assert list(first) == [b, a] and list(second) == [b, a]
+    b.z_index = 2
+    assert list(first) == [a, b] and list(second) == [a, b]
+
+
+def test_del_and_setitem() -> None:
+    a, b, c, d = _entities(4)
+    lst = EntityList()
+    lst.extend((a, b, c))
+    del lst[1]
+    assert list(lst) == [a, c] and b not in lst and not b._entity_lists
+    del lst[:]
+    assert len(lst) == 0 and a not in lst and c not in lst
+    lst.extend((a, b))
+    d.z_index = -1
+    lst[1] = d
+    assert list(lst) == [d, a] and b not in lst
+    d.z_index = 1
+    assert list(lst) == [a, d]
+
+
+def test_iadd_and_imul_keep_order() -> None:
+    a, b, c = _entities(3)
+    c.z_index = -1
+    lst = EntityList()
+    lst += (a, b, c)
+    assert list(lst) == [c, a, b]
+    lst *= 2
+    assert list(lst) == [c, c, a, a, b, b]
+    lst.remove(a)
+    assert a in lst
+    lst.remove(a)
+    assert a not in lst and not a._entity_lists
+    b.z_index = -2
+    assert list(lst) == [b, b, c, c]
+
+
+def test_sort_and_reverse_are_blocked() -> None:
+    lst = EntityList()
+    lst.extend(_entities(2))
+    with pytest.raises(NotImplementedError):
+        lst.sort()
+    with pytest.raises(NotImplementedError):
+        lst.reverse()
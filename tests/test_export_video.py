@@ -0,0 +1,60 @@
+"""Streaming frames to an encoder process with :meth:`Scene.export_video`."""
+import os
+import stat
+import sys
+from pathlib import Path
+
+import pytest
+
+from animator import Rect, Scene
+
+
+def _fake_encoder(tmp_path: Path, exit_code: int = 0) -> str:
+    """An executable that copies its input to the output path (the last argument), like a lossless ffmpeg."""
+    script = tmp_path / 'fake_encoder'
+    script.write_text(
+        f'#!{sys.executable}\n'
+        'import shutil, sys\n'
+        'with open(sys.argv[-1], "wb") as f:\n'
+        '    shutil.copyfileobj(sys.stdin.buffer, f)\n'
+        'sys.stderr.write("fake error")\n'
+        f'sys.exit({exit_code})\n'
+    )
+    script.chmod(script.stat().st_mode | stat.S_IXUSR)
+    return str(script)
+
+
+def _scene() -> Scene:
+    scene = Scene(32, 16)
+    scene.add(Rect(8, pos=(4, 4), style='fill'))
+    return scene
+
+
+@pytest.mark.parametrize('workers', [None, 2])
+def test_frames_are_piped_to_the_encoder(tmp_path: Path, workers: int | None) -> None:
+    scene = _scene()
+    output = tmp_path / 'out.raw'
+    assert scene.export_video(str(output), 5, ffmpeg=_fake_encoder(tmp_path), workers=workers) == 5
+    assert os.path.getsize(output) == 5 * scene.frame.nbytes
+
+
+def test_encoder_failure_is_reported(tmp_path: Path) -> None:
+    with pytest.raises(RuntimeError, match='fake error'):
+        _scene().export_video(str(tmp_path / 'out.raw'), 3, ffmpeg=_fake_encoder(tmp_path, 3))
+
+
+def test_update_error_is_not_replaced_by_the_encoder_error(tmp_path: Path) -> None:
+    scene = _scene()
+
+    @scene.on_update
+    def update() -> None:
+        if scene.frame_number == 2:
+            raise ValueError('update failed')
+
+    with pytest.raises(ValueError, match='update failed'):
+        scene.export_video(str(tmp_path / 'out.raw'), 5, ffmpeg=_fake_encoder(tmp_path, 1))
+
+
+def test_missing_encoder(tmp_path: Path) -> None:
+    with pytest.raises(FileNotFoundError):
+        _scene().export_video(str(tmp_path / 'out.raw'), ffmpeg=str(tmp_path / 'missing'))
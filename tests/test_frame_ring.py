@@ -0,0 +1,119 @@
+"""Handoff of frame buffers between threads with :class:`skia.FrameRing` and :meth:`Scene.stream_frames`."""
+import threading
+import time
+
+import numpy as np
+import pytest
+
+from animator import Rect, Scene, skia
+
+
+def _publish(ring: skia.FrameRing, buffers: list[int], value: int) -> int:
+    slot = ring.beginWrite()
+    buffers[slot] = value
+    ring.endWrite()
+    return slot
+
+
+def test_count_must_be_positive() -> None:
+    with pytest.raises(ValueError):
+        skia.FrameRing(0)
+    assert skia.FrameRing().count() == 2
+
+
+def test_frames_are_handed_off_in_order() -> None:
+    ring = skia.FrameRing(3)
+    buffers = [-1] * ring.count()
+    received: list[int] = []
+
+    def produce() -> None:
+        for i in range(200):
+            slot = ring.beginWrite()
+            if slot < 0:
+                return
+            buffers[slot] = i
+            ring.endWrite()
+        ring.close()
+
+    thread = threading.Thread(target=produce)
+    thread.start()
+    while (slot := ring.acquire()) >= 0:
+        received.append(buffers[slot])
+        ring.release()
+    thread.join()
+    assert received == list(range(200))
+    assert ring.dropped() == 0 and ring.pending() == 0
+
+
+def test_producer_waits_for_a_free_slot() -> None:
+    ring = skia.FrameRing(2)
+    buffers = [-1, -1]
+    _publish(ring, buffers, 0)
+    _publish(ring, buffers, 1)
+    slots: list[int] = []
+    thread = threading.Thread(target=lambda: slots.append(ring.beginWrite()))
+    thread.start()
+    time.sleep(0.05)
+    assert thread.is_alive() and not slots  # both slots hold unreleased frames
+    assert ring.acquire() == 0
+    ring.release()
+    thread.join(5)
+    assert slots == [0]
+
+
+def test_latest_drops_older_frames() -> None:
+    ring = skia.FrameRing(4)
+    buffers = [-1] * 4
+    for i in range(3):
+        _publish(ring, buffers, i)
+    assert ring.pending() == 3
+    slot = ring.acquire(latest=True)
+    assert buffers[slot] == 2
+    assert ring.dropped() == 2 and ring.pending() == 1
+    ring.release()
+    assert ring.pending() == 0
+
+    _publish(ring, buffers, 3)
+    assert buffers[ring.acquire(latest=True)] == 3
+    assert ring.dropped() == 2
+
+
+def test_close_drains_published_frames() -> None:
+    ring = skia.FrameRing(3)
+    buffers = [-1] * 3
+    _publish(ring, buffers, 0)
+    _publish(ring, buffers, 1)
+    ring.close()
+    assert ring.closed()
+    assert ring.beginWrite() == -1
+    for expected in (0, 1):
+        assert buffers[ring.acquire()] == expected
+        ring.release()
+    assert ring.acquire() == -1
+
+
+def test_close_wakes_a_waiting_consumer() -> None:
+    ring = skia.FrameRing(2)
+    threading.Timer(0.05, ring.close).start()
+    assert ring.acquire() == -1
+
+
+def _moving_scene() -> Scene:
+    scene = Scene(64, 48, color_type=skia.ColorType.kRGBA_8888_ColorType)
+    rect = Rect(10, pos=(0, 10), fill_color='red', style='fill')
+    scene.add(rect)
+    scene.on_update(lambda: rect.pos.offset(5, 1))
+    return scene
+
+
+@pytest.mark.parametrize('buffers', [2, 4])
+def test_stream_frames_matches_update(buffers: int) -> None:
+    expected = []
+    scene = _moving_scene()
+    for _ in range(8):
+        scene.update()
+        expected.append(scene.frame.copy())
+    frames = [frame.copy() for frame in _moving_scene().stream_frames(8, buffers)]
+    assert len(frames) == len(expected)
+    for frame, exp in zip(frames, expected):
+        np.testing.assert_array_equal(frame, exp)
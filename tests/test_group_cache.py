@@ -0,0 +1,98 @@
+"""Invalidation of the image cached by :attr:`Group.cache_as_bitmap`."""
+from typing import Callable
+
+import numpy as np
+
+from animator import Group, Image, Rect, Scene, skia
+
+
+def _cached_scene(make_scene: Callable[..., Scene], cache: bool = True) -> tuple[Scene, Group, Rect]:
+    scene = make_scene()
+    group = Group(cache_as_bitmap=cache, pos=(20, 20))
+    child = Rect(30, 20, pos=(10, 10), fill_color='red', style='fill')
+    group.add(child, Rect(10, pos=(50, 0), fill_color='lime', style='fill'))
+    scene.add(group)
+    scene.update()
+    return scene, group, child
+
+
+def test_unchanged_group_reuses_the_image(make_scene: Callable[..., Scene]) -> None:
+    scene, group, _ = _cached_scene(make_scene)
+    assert (group.cache_misses, group.cache_hits) == (1, 0)
+    scene.update()
+    scene.update()
+    assert (group.cache_misses, group.cache_hits) == (1, 2)
+
+
+def test_matches_uncached_group(make_scene: Callable[..., Scene]) -> None:
+    cached, _, _ = _cached_scene(make_scene, True)
+    uncached, _, _ = _cached_scene(make_scene, False)
+    np.testing.assert_array_equal(cached.frame, uncached.frame)
+
+
+def test_translating_the_group_reuses_the_image(make_scene: Callable[..., Scene]) -> None:
+    scene, group, _ = _cached_scene(make_scene)
+    group.pos.offset(50, 10)
+    scene.update()
+    assert (group.cache_misses, group.cache_hits) == (1, 1)
+    assert scene.frame[45:55, 95:105, 0].min() == 255  # the red rect moved
+    assert scene.frame[32:38, 32:38, 0].max() == 0
+
+
+def test_child_changes_invalidate_the_image(make_scene: Callable[..., Scene]) -> None:
+    scene, group, child = _cached_scene(make_scene)
+    changes = [
+        lambda: child.style.set_fill_color('blue'),
+        lambda: child.pos.offset(5, 0),
+        lambda: setattr(child, 'w', 60),
+        lambda: child.rotate(10),
+        lambda: setattr(child, 'visible', False),
+        lambda: child.style.fill_paint.setAlphaf(0.5),
+    ]
+    for i, change in enumerate(changes, 2):
+        change()
+        scene.update()
+        assert group.cache_misses == i, i
+        scene.update()
+        assert group.cache_misses == i, i
+
+
+def test_cached_image_shows_the_change(make_scene: Callable[..., Scene]) -> None:
+    scene, _, child = _cached_scene(make_scene)
+    child.style.set_fill_color('blue')
+    scene.update()
+    pixel = scene.frame[40, 45]
+    assert pixel[0] == 0 and pixel[2] == 255
+
+
+def test_scaling_the_group_invalidates_the_image(make_scene: Callable[..., Scene]) -> None:
+    scene, group, _ = _cached_scene(make_scene)
+    group.scale(2)
+    scene.update()
+    assert group.cache_misses == 2
+
+
+def test_child_without_a_complete_key_is_rasterized_every_frame(make_scene: Callable[..., Scene]) -> None:
+    scene = make_scene()
+    pixels = np.zeros((10, 10, 4), dtype=np.uint8)
+    pixels[..., 3] = 255
+    image = Image(skia.Image.fromarray(pixels), pos=(10, 10))
+    group = Group(cache_as_bitmap=True, pos=(0, 0))
+    group.add(image)
+    scene.add(group)
+    scene.update()
+    assert scene.frame[15, 15, 0] == 0
+    image.ndarray[..., 0] = 255  # edited in place, which the cache key does not see
+    scene.update()
+    assert scene.frame[15, 15, 0] == 255
+    assert group.cache_hits == 0
+
+    image.complete_cache_key = True
+    scene.update()
+    scene.update()
+    assert group.cache_hits == 1
+    image.ndarray[..., 0] = 0
+    group.invalidate_cache()
+    scene.update()
+    assert scene.frame[15, 15, 0] == 0
+    assert group.cache_hits == 1
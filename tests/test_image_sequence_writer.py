@@ -0,0 +1,67 @@
+"""Background encoding with :class:`skia.ImageSequenceWriter`."""
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+from animator import skia
+
+
+def _frame() -> np.ndarray:
+    frame = np.zeros((8, 16, 4), np.uint8)
+    frame[..., 0] = frame[..., 3] = 255
+    return frame
+
+
+def test_writes_all_images(tmp_path: Path) -> None:
+    frame = _frame()
+    with skia.ImageSequenceWriter(skia.EncodedImageFormat.kPNG, 100, 2, 2) as writer:
+        for i in range(6):
+            frame[0, 0, 1] = i
+            writer.write(frame, str(tmp_path / f'{i}.png'), skia.ColorType.kRGBA_8888_ColorType)
+        writer.flush()
+        assert writer.pending() == 0
+    for i in range(6):
+        image = np.array(skia.Image.open(str(tmp_path / f'{i}.png')).makeRasterImage())
+        assert image.shape == (8, 16, 4)
+        assert image[0, 0, 1] == i and (image[..., 3] == 255).all()  # green and alpha are the same in RGBA and BGRA
+
+
+def test_flush_raises_the_write_error_once(tmp_path: Path) -> None:
+    writer = skia.ImageSequenceWriter(skia.EncodedImageFormat.kPNG, 100, 1)
+    writer.write(_frame(), str(tmp_path / 'missing' / '0.png'))
+    with pytest.raises(RuntimeError, match='Failed to write'):
+        writer.flush()
+    assert writer.pending() == 0
+    writer.flush()  # the error was already reported
+    writer.close()
+
+
+def test_close_stops_even_if_it_raises(tmp_path: Path) -> None:
+    writer = skia.ImageSequenceWriter(skia.EncodedImageFormat.kPNG, 100, 1)
+    writer.write(_frame(), str(tmp_path / 'missing' / '0.png'))
+    with pytest.raises(RuntimeError):
+        writer.close()
+    with pytest.raises(RuntimeError, match='closed'):
+        writer.write(_frame(), str(tmp_path / '1.png'))
+
+
+def test_exception_in_the_block_is_not_replaced(tmp_path: Path) -> None:
+    with pytest.raises(ValueError, match='in the block'):
+        with skia.ImageSequenceWriter(skia.EncodedImageFormat.kPNG, 100, 1) as writer:
+            writer.write(_frame(), str(tmp_path / 'missing' / '0.png'))
+            raise ValueError('in the block')
+    with pytest.raises(RuntimeError, match='closed'):
+        writer.write(_frame(), str(tmp_path / '1.png'))
+
+
+def test_error_is_raised_on_exit(tmp_path: Path) -> None:
+    with pytest.raises(RuntimeError, match='Failed to write'):
+        with skia.ImageSequenceWriter(skia.EncodedImageFormat.kPNG, 100, 1) as writer:
+            writer.write(_frame(), str(tmp_path / 'missing' / '0.png'))
+
+
+def test_none_image_is_rejected(tmp_path: Path) -> None:
+    with skia.ImageSequenceWriter() as writer:
+        with pytest.raises((ValueError, TypeError)):
+            writer.write(None, str(tmp_path / 'none.png'))
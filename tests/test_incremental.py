@@ -0,0 +1,45 @@
+"""The damaged region of :attr:`Scene.incremental` updates."""
+from typing import Callable
+
+import numpy as np
+
+from animator import Image, Rect, Scene, skia
+
+
+def _incremental_scene(make_scene: Callable[..., Scene], *entities) -> Scene:
+    scene = make_scene(incremental=True)
+    scene.add(*entities)
+    scene.update()
+    return scene
+
+
+def test_unchanged_scene_has_no_damage(make_scene: Callable[..., Scene]) -> None:
+    scene = _incremental_scene(make_scene, Rect(10, pos=(20, 20), style='fill'))
+    assert scene.damage.getBounds() == skia.IRect.MakeWH(200, 100)
+    scene.update()
+    assert scene.damage.isEmpty()
+
+
+def test_moved_entity_damages_its_old_and_new_bounds(make_scene: Callable[..., Scene]) -> None:
+    rect = Rect(10, pos=(20, 20), style='fill')
+    scene = _incremental_scene(make_scene, rect, Rect(10, pos=(150, 70), style='fill'))
+    rect.pos.set(60, 20)
+    scene.update()
+    damage = scene.damage
+    assert damage.contains(skia.IRect.MakeXYWH(20, 20, 10, 10))
+    assert damage.contains(skia.IRect.MakeXYWH(60, 20, 10, 10))
+    assert not damage.intersects(skia.IRect.MakeLTRB(32, 0, 58, 100))  # between the two rects
+    assert skia.IRect.MakeLTRB(18, 18, 72, 32).contains(damage.getBounds())
+    assert scene.frame[20:30, 60:70, :3].any() and not scene.frame[20:30, 20:30, :3].any()
+
+
+def test_entity_without_a_complete_key_is_always_damaged(make_scene: Callable[..., Scene]) -> None:
+    pixels = np.zeros((10, 10, 4), dtype=np.uint8)
+    pixels[..., 3] = 255
+    image = Image(skia.Image.fromarray(pixels), pos=(20, 20))
+    scene = _incremental_scene(make_scene, image, Rect(10, pos=(150, 70), style='fill'))
+    image.ndarray[...] = 255  # edited in place
+    scene.update()
+    assert scene.damage.contains(skia.IRect.MakeXYWH(20, 20, 10, 10))
+    assert not scene.damage.intersects(skia.IRect.MakeXYWH(150, 70, 10, 10))
+    assert scene.frame[20:30, 20:30, :3].all()
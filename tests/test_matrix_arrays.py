@@ -0,0 +1,88 @@
+"""Mapping NumPy arrays of points and vectors with :meth:`skia.Matrix.mapPoints`, :meth:`skia.Matrix.mapVectors` and
+:meth:`skia.Matrix.MapPoints`."""
+import numpy as np
+import pytest
+
+from animator import skia
+
+
+def _matrix() -> skia.Matrix:
+    return skia.Matrix.Translate(5, -3).preRotate(30).preScale(2, 0.5)
+
+
+def _points(n: int = 7) -> np.ndarray:
+    return np.random.default_rng(1).uniform(-50, 50, (n, 2)).astype(np.float32)
+
+
+def _expected(matrix: skia.Matrix, points: np.ndarray) -> np.ndarray:
+    return np.array([(p.fX, p.fY) for p in matrix.mapPoints([skia.Point(*p) for p in points.tolist()])], np.float32)
+
+
+def test_map_points_in_place() -> None:
+    matrix, points = _matrix(), _points()
+    expected = _expected(matrix, points)
+    result = matrix.mapPoints(points)
+    assert np.shares_memory(result, points)
+    np.testing.assert_allclose(points, expected, rtol=1e-6, atol=1e-5)
+
+
+def test_map_points_into_out() -> None:
+    matrix, points = _matrix(), _points()
+    original = points.copy()
+    out = np.empty_like(points)
+    result = matrix.mapPoints(points, out)
+    assert np.shares_memory(result, out)
+    np.testing.assert_array_equal(points, original)
+    np.testing.assert_allclose(out, _expected(matrix, original), rtol=1e-6, atol=1e-5)
+
+
+def test_map_vectors_ignores_translation() -> None:
+    matrix, vectors = _matrix(), _points()
+    out = np.empty_like(vectors)
+    matrix.mapVectors(vectors, out)
+    linear = skia.Matrix.Concat(skia.Matrix.Translate(-matrix.getTranslateX(), -matrix.getTranslateY()), matrix)
+    np.testing.assert_allclose(out, _expected(linear, vectors), rtol=1e-6, atol=1e-4)
+    matrix.mapVectors(vectors)
+    np.testing.assert_array_equal(vectors, out)
+
+
+def test_read_only_input() -> None:
+    matrix, points = _matrix(), _points()
+    points.flags.writeable = False
+    with pytest.raises(ValueError):
+        matrix.mapPoints(points)
+    with pytest.raises(ValueError):
+        matrix.mapVectors(points)
+    out = np.empty_like(points)
+    matrix.mapPoints(points, out)  # only *out* is written
+    np.testing.assert_allclose(out, _expected(matrix, points), rtol=1e-6, atol=1e-5)
+
+
+def test_shape_errors() -> None:
+    matrix = _matrix()
+    with pytest.raises(ValueError):
+        matrix.mapPoints(np.zeros((4, 3), np.float32))
+    with pytest.raises(ValueError):
+        matrix.mapPoints(np.zeros((4, 2), np.float32), np.zeros((5, 2), np.float32))
+    with pytest.raises(ValueError):
+        matrix.mapVectors(np.zeros(8, np.float32))
+    with pytest.raises(ValueError):
+        skia.Matrix.MapPoints(np.zeros((2, 3, 3)), np.zeros((3, 4, 2), np.float32))
+    with pytest.raises(ValueError):
+        skia.Matrix.MapPoints(np.zeros((2, 2, 3)), np.zeros((2, 4, 2), np.float32))
+    with pytest.raises(ValueError):
+        skia.Matrix.MapPoints(np.zeros((2, 3, 3)), np.zeros((2, 4, 2), np.float32), np.zeros((2, 3, 2), np.float32))
+
+
+def test_batch_matches_each_matrix() -> None:
+    matrices = [_matrix(), skia.Matrix.Scale(3, 3), skia.Matrix.MakeAll(1, 0.1, 2, 0.2, 1, 3, 0.001, 0.002, 1)]
+    stacked = np.array([m.get9() for m in matrices], np.float32).reshape(-1, 3, 3)
+    points = np.stack([_points(5) for _ in matrices])
+    expected = np.stack([_expected(m, p) for m, p in zip(matrices, points)])
+
+    out = np.empty_like(points)
+    skia.Matrix.MapPoints(stacked, points, out)
+    np.testing.assert_allclose(out, expected, rtol=1e-5, atol=1e-4)
+    result = skia.Matrix.MapPoints(stacked, points)
+    assert np.shares_memory(result, points)
+    np.testing.assert_array_equal(points, out)
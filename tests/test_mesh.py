@@ -0,0 +1,85 @@
+"""NumPy construction of :class:`skia.Vertices` and the :class:`Mesh` entity."""
+import numpy as np
+import pytest
+
+from animator import Mesh, Scene, skia
+
+RGBA = skia.ColorType.kRGBA_8888_ColorType
+TRIANGLES = skia.Vertices.VertexMode.kTriangles_VertexMode
+_SQUARE = np.array([[0, 0], [10, 0], [10, 10], [0, 10]], np.float32)
+_SQUARE_INDICES = np.array([0, 1, 2, 0, 2, 3], np.uint16)
+
+
+def _draw(vertices: skia.Vertices) -> np.ndarray:
+    frame = np.zeros((20, 30, 4), np.uint8)
+    paint = skia.Paint(color=skia.ColorRED)
+    skia.Canvas(frame, RGBA).drawVertices(vertices, skia.BlendMode.kSrcOver, paint)
+    return frame
+
+
+def test_arrays_match_lists() -> None:
+    colors = np.array([0xFFFF0000, 0xFF00FF00, 0xFF0000FF, 0xFFFFFFFF], np.uint32)
+    from_arrays = skia.Vertices(TRIANGLES, _SQUARE, None, colors, _SQUARE_INDICES)
+    from_lists = skia.Vertices(
+        TRIANGLES, [skia.Point(*p) for p in _SQUARE.tolist()], None, colors.tolist(), _SQUARE_INDICES.tolist()
+    )
+    assert from_arrays.bounds() == from_lists.bounds()
+    np.testing.assert_array_equal(_draw(from_arrays), _draw(from_lists))
+    copy = skia.Vertices.MakeCopy(TRIANGLES, _SQUARE, None, colors, _SQUARE_INDICES)
+    np.testing.assert_array_equal(_draw(copy), _draw(from_lists))
+
+
+def test_indices_and_offset() -> None:
+    vertices = skia.Vertices(TRIANGLES, _SQUARE, indices=_SQUARE_INDICES, offset=skia.Point(15, 5))
+    assert vertices.bounds() == skia.Rect.MakeLTRB(15, 5, 25, 15)
+    frame = _draw(vertices)
+    assert (frame[6:14, 16:24] == [255, 0, 0, 255]).all()
+    assert not frame[:, :15].any()
+    unindexed = skia.Vertices(TRIANGLES, _SQUARE)  # only the first 3 vertices form a triangle
+    assert not _draw(unindexed)[8, 2].any()
+
+
+def test_invalid_arrays_are_rejected() -> None:
+    with pytest.raises(ValueError):
+        skia.Vertices(TRIANGLES, np.zeros((3, 3), np.float32))
+    with pytest.raises(ValueError):
+        skia.Vertices(TRIANGLES, _SQUARE, colors=np.zeros(3, np.uint32))
+    with pytest.raises(ValueError):
+        skia.Vertices(TRIANGLES, _SQUARE, texs=np.zeros((4, 3), np.float32))
+    with pytest.raises(ValueError):
+        skia.Vertices(TRIANGLES, _SQUARE, indices=_SQUARE_INDICES.reshape(2, 3))
+    with pytest.raises(ValueError):
+        skia.Vertices(TRIANGLES, _SQUARE, indices=np.array([0, 1, 4], np.uint16))
+    with pytest.raises(TypeError):
+        skia.Vertices(TRIANGLES, _SQUARE.astype(np.float64))  # float32 is required, the data is not converted
+
+
+def test_mesh_rebuilds_only_after_changes() -> None:
+    scene = Scene(60, 30)
+    mesh = Mesh(_SQUARE.copy(), indices=_SQUARE_INDICES, pos=(0, 0), fill_color='red')
+    scene.add(mesh)
+    scene.update()
+    assert scene.frame[5, 5, :3].any() and not scene.frame[5, 35, :3].any()
+    version = mesh.version
+
+    mesh.positions[:, 0] += 30  # in place, without calling changed()
+    scene.update()
+    assert mesh.version == version
+    assert scene.frame[5, 5, :3].any() and not scene.frame[5, 35, :3].any()
+
+    mesh.changed()
+    scene.update()
+    assert mesh.version != version
+    assert not scene.frame[5, 5, :3].any() and scene.frame[5, 35, :3].any()
+
+    version = mesh.version
+    mesh.positions = _SQUARE
+    assert mesh.version != version
+    scene.update()
+    assert scene.frame[5, 5, :3].any() and not scene.frame[5, 35, :3].any()
+
+
+def test_mesh_uses_float32_positions_without_copying() -> None:
+    positions = _SQUARE.copy()
+    assert np.shares_memory(Mesh(positions).positions, positions)
+    assert Mesh(positions.astype(np.float64)).positions.dtype == np.float32
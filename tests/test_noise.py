@@ -0,0 +1,105 @@
+"""Seeded noise of :class:`skia.Noise` and :func:`animator.processing.noise`."""
+import numpy as np
+import pytest
+
+from animator import processing, skia
+
+TYPES = list(skia.Noise.Type.__members__.values())
+
+
+def _points(dims: int, count: int = 500) -> np.ndarray:
+    return np.random.default_rng(1).uniform(-50, 50, (count, dims)).astype(np.float32)
+
+
+@pytest.mark.parametrize('type', TYPES)
+def test_same_seed_gives_same_values(type: skia.Noise.Type) -> None:
+    points = _points(3)
+    first = skia.Noise(7, type)(points)
+    np.testing.assert_array_equal(skia.Noise(7, type)(points), first)
+    assert not np.array_equal(skia.Noise(8, type)(points), first)
+
+
+@pytest.mark.parametrize('type', TYPES)
+@pytest.mark.parametrize('octaves', [1, 4, 8])
+def test_values_are_in_the_unit_interval(type: skia.Noise.Type, octaves: int) -> None:
+    noise = skia.Noise(3, type, octaves)
+    for dims in range(1, 4 if type == skia.Noise.Type.kValue else 5):
+        values = noise(_points(dims, 5000))
+        assert values.min() >= 0 and values.max() < 1, dims
+        assert values.max() - values.min() > 0.1, dims  # not a constant
+
+
+@pytest.mark.parametrize('type', TYPES)
+def test_scalar_array_and_fill_agree(type: skia.Noise.Type) -> None:
+    noise = skia.Noise(5, type)
+    x, y, z, scale = np.float32(1.5), np.float32(-2.25), np.float32(0.75), np.float32(0.125)
+    cols = x + np.arange(12, dtype=np.float32) * scale
+    rows = y + np.arange(9, dtype=np.float32) * scale
+    grid = np.stack(np.broadcast_arrays(cols[None, :], rows[:, None], z), -1)
+    expected = noise(grid)
+    assert expected.shape == (9, 12)
+    for row, col in [(0, 0), (4, 7), (8, 11)]:
+        assert noise(*grid[row, col].tolist()) == pytest.approx(expected[row, col], abs=1e-6)
+
+    filled = np.zeros((9, 12), np.float32)
+    noise.fill(filled, x, y, z, scale)
+    np.testing.assert_allclose(filled, expected, atol=1e-6)
+    flat = np.zeros((9, 12), np.float32)
+    noise.fill(flat, x, y, None, scale)
+    np.testing.assert_allclose(flat, noise(grid[..., :2]), atol=1e-6)
+
+    pixels = np.zeros((9, 12, 4), np.uint8)
+    noise.fill(pixels, x, y, z, scale)
+    assert (pixels[..., 3] == 255).all()
+    for c in range(3):
+        np.testing.assert_array_equal(pixels[..., c], pixels[..., 0])
+    assert np.abs(pixels[..., 0].astype(int) - np.minimum(filled * 256, 255).astype(int)).max() <= 1
+
+
+def test_uint8_fill_clamps_values_outside_the_unit_interval() -> None:
+    noise = skia.Noise(5, skia.Noise.Type.kPerlin, 2, -2)
+    filled = np.zeros((16, 16), np.float32)
+    noise.fill(filled, scale=0.3)
+    assert filled.min() < 0
+    pixels = np.zeros((16, 16), np.uint8)
+    noise.fill(pixels, scale=0.3)
+    assert (pixels[filled < 0] == 0).all()
+    np.testing.assert_array_equal(pixels, np.clip(filled * 256, 0, 255).astype(np.uint8))
+
+
+def test_array_result_drops_the_coordinate_axis() -> None:
+    noise = skia.Noise()
+    assert noise(np.zeros((2, 3, 4), np.float32)).shape == (2, 3)
+    assert noise(np.zeros(2, np.float32)).shape == ()
+
+
+def test_invalid_arguments() -> None:
+    with pytest.raises(ValueError):
+        skia.Noise(octaves=0)
+    with pytest.raises(ValueError):
+        skia.Noise(type=skia.Noise.Type.kValue)(0, 0, 0, 0)
+    with pytest.raises(ValueError):
+        skia.Noise()(np.zeros((3, 5), np.float32))
+    with pytest.raises(ValueError):
+        skia.Noise().fill(np.zeros((4, 4), np.float64))
+    with pytest.raises(ValueError):
+        skia.Noise().fill(np.zeros((4, 8), np.float32)[:, ::2])
+
+
+def test_processing_noise_seed_and_detail() -> None:
+    processing.noiseDetail(4, 0.5)
+    processing.noiseSeed(42)
+    first = [processing.noise(i * 0.3, 1.7, 0.2) for i in range(20)]
+    processing.noiseSeed(42)
+    assert [processing.noise(i * 0.3, 1.7, 0.2) for i in range(20)] == first
+    assert all(0 <= n < 1 for n in first)
+    expected = skia.Noise(42, skia.Noise.Type.kValue, 4, 0.5)
+    assert first == [expected(i * 0.3, 1.7, 0.2) for i in range(20)]
+
+    processing.noiseDetail(2, 0.25)
+    detailed = skia.Noise(42, skia.Noise.Type.kValue, 2, 0.25)
+    assert processing.noise(3.1, 0.4) == detailed(3.1, 0.4, 0)
+    processing.noiseSeed(43)  # keeps the detail
+    assert processing.noise(3.1, 0.4) == skia.Noise(43, skia.Noise.Type.kValue, 2, 0.25)(3.1, 0.4, 0)
+    processing.noiseSeed(-1)
+    assert processing.noise(3.1, 0.4) == skia.Noise(2**64 - 1, skia.Noise.Type.kValue, 2, 0.25)(3.1, 0.4, 0)
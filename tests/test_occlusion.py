@@ -0,0 +1,87 @@
+"""Occlusion culling when the bounds or opacity of entities change."""
+from typing import Callable
+
+import pytest
+
+from animator import Group, Rect, Scene
+
+OccludedPair = tuple[Scene, Rect, Rect]
+
+
+@pytest.fixture
+def scene(make_scene: Callable[..., Scene]) -> Scene:
+    return make_scene(occlusion_culling=True)
+
+
+@pytest.fixture
+def occluded_pair(scene: Scene) -> OccludedPair:
+    back = Rect(20, pos=(40, 40), fill_color='red', style='fill')
+    front = Rect(100, pos=(0, 0), fill_color='blue', style='fill')
+    front.z_index = 1
+    scene.add(back, front)
+    scene.update()
+    assert scene.occluded_count == 1
+    return scene, back, front
+
+
+def test_entity_behind_an_opaque_entity_is_skipped(occluded_pair: OccludedPair) -> None:
+    scene, _, _ = occluded_pair
+    assert scene.drawn_count == 1
+    scene.occlusion_culling = False
+    scene.update()
+    assert scene.occluded_count == 0 and scene.drawn_count == 2
+
+
+def test_occluded_entity_is_drawn_when_occluder_moves(occluded_pair: OccludedPair) -> None:
+    scene, _, front = occluded_pair
+    front.pos.set(100, 0)
+    scene.update()
+    assert scene.occluded_count == 0
+    assert scene.frame[45:55, 45:55, 0].min() == 255
+
+
+def test_occluded_entity_is_drawn_when_occluder_shrinks(occluded_pair: OccludedPair) -> None:
+    scene, _, front = occluded_pair
+    front.w = front.h = 30
+    scene.update()
+    assert scene.occluded_count == 0
+    assert scene.frame[45:55, 45:55, 0].min() == 255
+
+
+def test_occluded_entity_is_drawn_when_occluder_turns_translucent(occluded_pair: OccludedPair) -> None:
+    scene, _, front = occluded_pair
+    front.style.set_fill_color('blue', 0.5)
+    scene.update()
+    assert scene.occluded_count == 0
+    assert scene.frame[45:55, 45:55, 0].min() > 0
+
+
+def test_occluded_entity_is_drawn_when_occluder_is_hidden(occluded_pair: OccludedPair) -> None:
+    scene, _, front = occluded_pair
+    front.visible = False
+    scene.update()
+    assert scene.occluded_count == 0
+    assert scene.frame[45:55, 45:55, 0].min() == 255
+
+
+def test_occluded_entity_is_drawn_when_it_grows(occluded_pair: OccludedPair) -> None:
+    scene, back, _ = occluded_pair
+    back.w = 150
+    scene.update()
+    assert scene.occluded_count == 0
+    assert scene.frame[45:55, 105:115, 0].min() == 255
+
+
+def test_group_is_drawn_when_a_child_moves_out(scene: Scene) -> None:
+    group = Group()
+    child = Rect(20, pos=(40, 40), fill_color='red', style='fill')
+    group.add(child)
+    front = Rect(100, pos=(0, 0), fill_color='blue', style='fill')
+    front.z_index = 1
+    scene.add(group, front)
+    scene.update()
+    assert scene.occluded_count == 1
+    child.pos.set(140, 40)
+    scene.update()
+    assert scene.occluded_count == 0
+    assert scene.frame[45:55, 145:155, 0].min() == 255
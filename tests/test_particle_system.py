@@ -0,0 +1,112 @@
+"""Simulation and drawing of :class:`skia.ParticleSystem` and the :class:`ParticleSystem` entity."""
+import math
+
+import numpy as np
+import pytest
+
+from animator import ParticleSystem, Scene, skia
+
+RGBA = skia.ColorType.kRGBA_8888_ColorType
+
+
+def _system(seed: int = 1, capacity: int = 1000) -> skia.ParticleSystem:
+    system = skia.ParticleSystem(capacity, seed)
+    system.emitter.position = skia.Point(50, 50)
+    system.emitter.extent = skia.Point(10, 5)
+    system.emitter.minSpeed, system.emitter.maxSpeed = 10, 50
+    system.emitter.minLife, system.emitter.maxLife = 0.5, 2
+    system.gravity = skia.Point(0, 9.8)
+    return system
+
+
+def _still_system(position: tuple[float, float], life: float = 1, capacity: int = 100) -> skia.ParticleSystem:
+    system = skia.ParticleSystem(capacity, 1)
+    system.emitter.position = skia.Point(*position)
+    system.emitter.minSpeed = system.emitter.maxSpeed = 0
+    system.emitter.minLife = system.emitter.maxLife = life
+    return system
+
+
+def test_same_seed_is_deterministic() -> None:
+    first, second, other = _system(7), _system(7), _system(8)
+    for system in (first, second, other):
+        system.emit(100)
+        for _ in range(3):
+            system.step(0.1)
+    np.testing.assert_array_equal(first.positions(), second.positions())
+    assert not np.array_equal(first.positions(), other.positions())
+
+
+def test_emit_is_limited_by_capacity() -> None:
+    system = _system(capacity=10)
+    system.emit(15)
+    assert system.count() == 10
+    system.emit(1)
+    assert system.count() == 10
+
+
+def test_rate_spawns_particles_over_time() -> None:
+    system = _system()
+    system.emitter.rate = 10
+    system.emitter.minLife = 1
+    system.step(0.25)
+    assert system.count() == 2
+    system.step(0.25)
+    assert system.count() == 5  # the fractions of particles carry over
+
+
+def test_expired_particles_are_removed_and_compacted() -> None:
+    system = _still_system((10, 10), life=0.2)
+    system.emit(5)
+    system.emitter.position = skia.Point(60, 30)
+    system.emitter.minLife = system.emitter.maxLife = 1
+    system.emit(5)
+    system.step(0.1)
+    assert system.count() == 10
+    system.step(0.15)
+    assert system.count() == 5
+    np.testing.assert_array_equal(system.positions(), np.full((5, 2), [60, 30], np.float32))
+    system.step(1)
+    assert system.count() == 0 and system.positions().shape == (0, 2)
+
+
+def test_bounds() -> None:
+    system = _still_system((10, 20))
+    assert system.bounds(None, 4).isEmpty()
+    system.emit(3)
+    r = 4 * math.sqrt(2) / 2
+    bounds = system.bounds(None, 4)
+    assert bounds.left() == pytest.approx(10 - r) and bounds.right() == pytest.approx(10 + r)
+    assert bounds.top() == pytest.approx(20 - r) and bounds.bottom() == pytest.approx(20 + r)
+    sprite = skia.Image.fromarray(np.full((6, 8, 4), 255, np.uint8))
+    assert system.bounds(sprite).width() == pytest.approx(10)  # the diagonal of the sprite
+
+
+def test_draws_squares_in_several_batches() -> None:
+    system = _still_system((10, 10), capacity=20000)
+    system.emitter.startColor = system.emitter.endColor = skia.Color4f(1, 0, 0, 1)
+    system.emit(17000)  # more than one batch of 16384 quads
+    system.emitter.position = skia.Point(30, 10)
+    system.emitter.startColor = system.emitter.endColor = skia.Color4f(0, 0, 1, 1)
+    system.emit(10)
+    frame = np.zeros((20, 40, 4), np.uint8)
+    system.draw(skia.Canvas(frame, RGBA), skia.Paint(), None, 4)
+    assert (frame[9:11, 9:11] == [255, 0, 0, 255]).all()
+    assert (frame[9:11, 29:31] == [0, 0, 255, 255]).all()
+    assert not frame[:, 15:25].any()
+
+
+def test_entity_steps_once_per_frame() -> None:
+    scene = Scene(100, 60, fps=10)
+    particles = ParticleSystem(100, pos=(0, 0))
+    particles.emitter.rate = 10
+    particles.emitter.minSpeed = particles.emitter.maxSpeed = 0
+    scene.add(particles)
+    scene.update()
+    assert particles.system.count() == 1
+    particles._draw_state()
+    particles._draw_bounds()
+    particles.world_bounds
+    assert particles.system.count() == 1
+    scene.update()
+    assert particles.system.count() == 2
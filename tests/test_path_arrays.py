@@ -0,0 +1,66 @@
+"""Bulk export and import of path geometry with :meth:`skia.Path.toarrays` and :meth:`skia.Path.fromarrays`."""
+import numpy as np
+import pytest
+
+from animator import skia
+
+
+def _every_verb() -> skia.Path:
+    path = skia.Path()
+    path.moveTo(0, 0)
+    path.lineTo(10, 0)
+    path.quadTo(20, 0, 20, 10)
+    path.conicTo(20, 20, 10, 20, 0.5)
+    path.cubicTo(5, 20, 0, 15, 0, 10)
+    path.close()
+    path.addCircle(50, 50, 10)
+    path.moveTo(70, 70)
+    path.lineTo(80, 75)
+    return path
+
+
+def test_arrays_have_expected_layout() -> None:
+    path = _every_verb()
+    verbs, points, weights = path.toarrays()
+    assert verbs.dtype == np.uint8 and verbs.shape == (path.countVerbs(),)
+    assert points.dtype == np.float32 and points.shape == (path.countPoints(), 2)
+    assert weights.dtype == np.float32
+    assert weights[0] == pytest.approx(0.5)
+    assert len(weights) == np.count_nonzero(verbs == int(skia.Path.Verb.kConic_Verb))
+    np.testing.assert_array_equal(points, [(p.fX, p.fY) for p in path.getPoints()])
+
+
+@pytest.mark.parametrize(
+    'path', [_every_verb(), skia.Path(), skia.Path.Rect(skia.Rect.MakeXYWH(1, 2, 3, 4))], ids=['all', 'empty', 'rect']
+)
+def test_round_trip(path: skia.Path) -> None:
+    path.setFillType(skia.PathFillType.kEvenOdd)
+    copy = skia.Path.fromarrays(*path.toarrays(), ft=path.getFillType())
+    assert copy == path
+    assert copy.getFillType() == skia.PathFillType.kEvenOdd
+
+
+def test_from_arrays_converts_types() -> None:
+    path = skia.Path.fromarrays([0, 1, 1, 5], [[0, 0], [10, 0], [10, 10]])
+    expected = skia.Path().moveTo(0, 0).lineTo(10, 0).lineTo(10, 10).close()
+    assert path == expected
+
+
+def test_from_arrays_rejects_invalid_data() -> None:
+    with pytest.raises(ValueError):
+        skia.Path.fromarrays(np.array([1], np.uint8), np.zeros((1, 2), np.float32))  # line without move
+    with pytest.raises(ValueError):
+        skia.Path.fromarrays(np.array([0, 1], np.uint8), np.zeros((1, 2), np.float32))  # too few points
+    with pytest.raises(ValueError):
+        skia.Path.fromarrays(np.array([0, 1], np.uint8), np.zeros((2, 3), np.float32))  # wrong shape
+
+
+def test_polygon_from_array_matches_list() -> None:
+    points = np.array([[0, 0], [10, 0], [5, 8]], np.float32)
+    assert skia.Path.Polygon(points, True) == skia.Path.Polygon([skia.Point(*p) for p in points.tolist()], True)
+
+
+def test_get_points_returns_all_points() -> None:
+    path = skia.Path().moveTo(0, 0).cubicTo(1, 1, 2, 2, 3, 3)
+    assert path.countPoints() > path.countVerbs()
+    assert len(path.getPoints()) == path.countPoints()
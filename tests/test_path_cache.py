@@ -0,0 +1,66 @@
+"""Hits and misses of the content cache of path entities (see :attr:`Entity.cache_content`)."""
+import numpy as np
+
+from animator import Rect, Scene, skia
+
+
+def _cached_rect(cache: bool = True) -> tuple[Scene, Rect]:
+    scene = Scene(100, 60)
+    rect = Rect(20, 10, pos=(10, 10), fill_color='red', style='fill')
+    rect.cache_content = cache
+    scene.add(rect)
+    scene.update()
+    return scene, rect
+
+
+def test_caching_is_opt_in() -> None:
+    _, rect = _cached_rect(False)
+    assert not Rect(10).cache_content
+    assert (rect.cache_misses, rect.cache_hits) == (0, 0)
+
+
+def test_static_path_hits() -> None:
+    scene, rect = _cached_rect()
+    scene.update()
+    scene.update()
+    assert (rect.cache_misses, rect.cache_hits) == (1, 2)
+
+
+def test_matches_uncached_drawing() -> None:
+    cached, _ = _cached_rect(True)
+    uncached, _ = _cached_rect(False)
+    np.testing.assert_array_equal(cached.frame, uncached.frame)
+
+
+def test_moving_the_entity_hits() -> None:
+    scene, rect = _cached_rect()
+    rect.pos.offset(30, 5)
+    rect.rotate(10)
+    scene.update()
+    assert (rect.cache_misses, rect.cache_hits) == (1, 1)
+
+
+def test_changes_miss() -> None:
+    scene, rect = _cached_rect()
+    changes = [
+        lambda: setattr(rect, 'w', 30),  # rebuilt
+        lambda: rect.style.set_fill_color('blue'),  # restyled
+        lambda: rect.shift(2, 0),  # re-offset
+        lambda: rect.path.addRect(skia.Rect.MakeXYWH(50, 0, 5, 5)),  # modified in place
+        lambda: rect.transform_path(skia.Matrix.Scale(2, 1)),  # transformed in place
+        lambda: setattr(rect, 'preserve_stroke', True),
+    ]
+    for i, change in enumerate(changes, 2):
+        change()
+        scene.update()
+        assert rect.cache_misses == i, i
+        scene.update()
+        assert rect.cache_misses == i, i
+
+
+def test_in_place_edit_is_drawn() -> None:
+    scene, rect = _cached_rect()
+    assert not scene.frame[40:50, 60:70, :3].any()
+    rect.path.addRect(skia.Rect.MakeXYWH(50, 30, 10, 10))
+    scene.update()
+    assert scene.frame[40:50, 60:70, :3].any()
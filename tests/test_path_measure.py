@@ -0,0 +1,36 @@
+"""Resetting and batched sampling of :class:`skia.PathMeasure`."""
+import numpy as np
+import pytest
+
+from animator import skia
+
+
+def _line() -> skia.Path:
+    return skia.Path().moveTo(0, 0).lineTo(100, 0)
+
+
+def test_set_path_none_resets() -> None:
+    measure = skia.PathMeasure(_line())
+    assert measure.getLength() == pytest.approx(100)
+    measure.setPath(None)
+    assert measure.getLength() == 0
+    assert measure.getTotalLength() == 0
+    with pytest.raises(RuntimeError):
+        measure.sample(4)
+
+
+def test_set_path_replaces_the_path() -> None:
+    measure = skia.PathMeasure()
+    measure.setPath(_line())
+    assert measure.getTotalLength() == pytest.approx(100)
+    positions, tangents = measure.sample(5)
+    np.testing.assert_allclose(positions, [[0, 0], [25, 0], [50, 0], [75, 0], [100, 0]], atol=1e-4)
+    np.testing.assert_allclose(tangents, [[1, 0]] * 5, atol=1e-4)
+
+
+def test_sample_spans_all_contours() -> None:
+    path = _line().moveTo(0, 10).lineTo(0, 60)
+    measure = skia.PathMeasure(path)
+    assert measure.getTotalLength() == pytest.approx(150)
+    positions, _ = measure.sample(np.array([50, 125, 1000]))
+    np.testing.assert_allclose(positions, [[50, 0], [0, 35], [0, 60]], atol=1e-4)
@@ -0,0 +1,90 @@
+"""Endpoints and in-betweens of :class:`skia.PathMorph`."""
+from concurrent.futures import ThreadPoolExecutor
+
+import pytest
+
+from animator import skia
+
+
+def _rect(l: float, t: float, r: float, b: float) -> skia.Path:
+    path = skia.Path()
+    path.addRect(skia.Rect.MakeLTRB(l, t, r, b))
+    return path
+
+
+def _circle(x: float, y: float, r: float) -> skia.Path:
+    path = skia.Path()
+    path.addCircle(x, y, r)
+    return path
+
+
+def _ltrb(rect: skia.Rect) -> tuple[float, float, float, float]:
+    return rect.fLeft, rect.fTop, rect.fRight, rect.fBottom
+
+
+def _length(path: skia.Path) -> float:
+    measure = skia.PathMeasure(path)
+    length = measure.getLength()
+    while measure.nextContour():
+        length += measure.getLength()
+    return length
+
+
+def _same_shape(actual: skia.Path, expected: skia.Path, inside: list, outside: list, bounds: bool = True) -> None:
+    """Conics are approximated by cubics, so the shapes are compared with a small tolerance."""
+    if bounds:
+        assert _ltrb(actual.computeTightBounds()) == pytest.approx(_ltrb(expected.computeTightBounds()), abs=0.05)
+    assert _length(actual) == pytest.approx(_length(expected), rel=1e-3)
+    for x, y in inside:
+        assert actual.contains(x, y), (x, y)
+    for x, y in outside:
+        assert not actual.contains(x, y), (x, y)
+
+
+def test_endpoints_rect_to_circle() -> None:
+    start, end = _rect(0, 0, 40, 20), _circle(100, 100, 30)
+    morph = skia.PathMorph(start, end)
+    _same_shape(morph.interpolate(0), start, [(1, 1), (39, 19)], [(41, 10), (100, 100)])
+    _same_shape(morph.interpolate(1), end, [(100, 100), (100, 71)], [(78, 78), (20, 10)])
+
+
+def test_missing_contour_grows_from_a_point() -> None:
+    start = _rect(0, 0, 40, 40)
+    end = _rect(0, 0, 40, 40)
+    end.addRect(skia.Rect.MakeLTRB(60, 0, 80, 20))
+    morph = skia.PathMorph(start, end)
+    assert morph.countContours() == 2
+    # At 0, the second rect is a single point at its center, which adds nothing to the fill but does to the bounds.
+    _same_shape(morph.interpolate(0), start, [(20, 20)], [(65, 5), (75, 15)], bounds=False)
+    assert _ltrb(morph.interpolate(0).computeTightBounds()) == pytest.approx((0, 0, 70, 40), abs=1e-3)
+    _same_shape(morph.interpolate(1), end, [(20, 20), (65, 5), (75, 15)], [(50, 10)])
+    half = morph.interpolate(0.5)
+    assert half.contains(20, 20) and half.contains(70, 10) and not half.contains(63, 3)
+
+
+def test_in_between_and_fill_type() -> None:
+    start, end = _rect(0, 0, 20, 20), _rect(100, 0, 120, 20)
+    start.setFillType(skia.PathFillType.kEvenOdd)
+    morph = skia.PathMorph(start, end)
+    quarter = morph.interpolate(0.25)
+    assert _ltrb(quarter.computeTightBounds()) == pytest.approx((25, 0, 45, 20), abs=1e-3)
+    assert quarter.getFillType() == skia.PathFillType.kEvenOdd
+    assert morph.interpolate(0.75).getFillType() == skia.PathFillType.kWinding
+
+
+def test_interpolate_into_dst() -> None:
+    morph = skia.PathMorph(_rect(0, 0, 40, 20), _circle(100, 100, 30))
+    dst = _circle(0, 0, 1)
+    for t in (0, 0.3, 1):
+        morph.interpolate(t, dst)
+        assert dst == morph.interpolate(t)
+
+
+def test_morph_shared_by_threads() -> None:
+    start, end = _rect(0, 0, 40, 20), _circle(100, 100, 30)
+    start.addCircle(200, 10, 5)
+    morph = skia.PathMorph(start, end)
+    ts = [i / 200 for i in range(201)]
+    expected = [morph.interpolate(t) for t in ts]
+    with ThreadPoolExecutor(8) as executor:
+        assert list(executor.map(morph.interpolate, ts * 4)) == expected * 4
@@ -0,0 +1,111 @@
+"""Parallel rasterization of recorded frames with :func:`skia.renderPictures` and :meth:`Scene.render`."""
+import numpy as np
+import pytest
+
+from animator import Rect, Scene, skia
+
+RGBA = skia.ColorType.kRGBA_8888_ColorType
+
+
+def _solid_picture(i: int) -> skia.Picture:
+    recorder = skia.PictureRecorder()
+    canvas = recorder.beginRecording(skia.Rect.MakeWH(16, 8))
+    canvas.clear(skia.Color4f(i / 255, 0, 1 - i / 255, 1))
+    return recorder.finishRecordingAsPicture()
+
+
+@pytest.mark.parametrize('workers', [1, 3, 0])
+def test_render_pictures_keeps_order(workers: int) -> None:
+    pictures = [_solid_picture(i) for i in range(20)]
+    frames = skia.renderPictures(pictures, 16, 8, workers, RGBA)
+    assert len(frames) == len(pictures)
+    for i, frame in enumerate(frames):
+        assert frame.shape == (8, 16, 4) and frame.dtype == np.uint8
+        assert (frame == [i, 0, 255 - i, 255]).all(), i
+
+
+def test_render_pictures_clears_between_pictures() -> None:
+    recorder = skia.PictureRecorder()
+    recorder.beginRecording(skia.Rect.MakeWH(16, 8))
+    empty = recorder.finishRecordingAsPicture()
+    frames = skia.renderPictures([_solid_picture(0), empty, empty], 16, 8, 1, RGBA)
+    assert frames[0][..., 3].all()
+    assert not frames[1].any() and not frames[2].any()
+
+
+def test_render_pictures_rejects_invalid_arguments() -> None:
+    with pytest.raises(ValueError):
+        skia.renderPictures([_solid_picture(0)], 0, 8)
+    with pytest.raises((ValueError, TypeError)):
+        skia.renderPictures([None], 16, 8)  # type: ignore
+
+
+def _moving_scene() -> Scene:
+    scene = Scene(96, 64)
+    rect = Rect(20, 12, pos=(0, 10), fill_color='red', style='fill')
+    scene.add(rect)
+
+    @scene.on_update
+    def update() -> None:
+        rect.pos.set(scene.frame_number * 7.25, 10 + scene.frame_number * 3.5)
+        rect.rotate(10)
+
+    return scene
+
+
+@pytest.mark.parametrize('workers, batch_size', [(1, 1), (3, 2), (4, 0)])
+def test_scene_render_matches_update(workers: int, batch_size: int) -> None:
+    expected = []
+    scene = _moving_scene()
+    for _ in range(9):
+        scene.update()
+        expected.append(scene.frame.copy())
+
+    frames = list(_moving_scene().render(9, workers, batch_size))
+    assert len(frames) == len(expected)
+    for i, (frame, exp) in enumerate(zip(frames, expected)):
+        np.testing.assert_array_equal(frame, exp, err_msg=f'frame {i}')
+
+
+def test_scene_render_stops_with_update_function() -> None:
+    scene = Scene(32, 32)
+    scene.on_update(lambda: scene.frame_number == 5)
+    assert len(list(scene.render(workers=2, batch_size=2))) == 5
+
+
+def _detailed_picture(width: int, height: int, bbh: bool) -> skia.Picture:
+    recorder = skia.PictureRecorder()
+    canvas = recorder.beginRecording(skia.Rect.MakeWH(width, height), skia.RTreeFactory() if bbh else None)
+    canvas.clear(skia.Color4f(0.1, 0.2, 0.3, 1))
+    paint = skia.Paint()
+    paint.setAntiAlias(True)
+    paint.setDither(True)
+    paint.setShader(
+        skia.GradientShader.MakeLinear([(0, 0), (width, height)], [skia.Color4f(1, 0, 0, 1), skia.Color4f(0, 0, 1, 1)])
+    )
+    canvas.drawCircle(width * 0.4, height * 0.5, height * 0.45, paint)
+    paint.setShader(None)
+    paint.setColor4f(skia.Color4f(0, 1, 0, 0.5))
+    canvas.rotate(17)
+    canvas.drawRect(skia.Rect.MakeXYWH(width * 0.3, -5, width * 0.5, height * 0.3), paint)
+    return recorder.finishRecordingAsPicture()
+
+
+@pytest.mark.parametrize('tile, workers, bbh', [(16, 1, False), (16, 4, True), (13, 3, True), (1000, 2, False)])
+def test_render_picture_tiled_matches_playback(tile: int, workers: int, bbh: bool) -> None:
+    width, height = 101, 67  # not a multiple of the tile size
+    picture = _detailed_picture(width, height, bbh)
+    expected = np.zeros((height, width, 4), np.uint8)
+    picture.playback(skia.Canvas(expected, RGBA))
+    frame = np.zeros_like(expected)
+    skia.renderPictureTiled(picture, frame, tile, tile, workers, RGBA)
+    np.testing.assert_array_equal(frame, expected)
+
+
+def test_scene_update_tiled_matches_update() -> None:
+    expected = _moving_scene()
+    tiled = _moving_scene()
+    for _ in range(3):
+        expected.update()
+        tiled.update_tiled(32, 3)
+        np.testing.assert_array_equal(tiled.frame, expected.frame)
@@ -0,0 +1,74 @@
+"""Keyframe lookup and application of :class:`animator.Timeline`."""
+import pytest
+
+from animator import Circle, Timeline, skia
+from animator.anim import easing
+from animator.anim.timeline import ColorSpace
+
+
+def _scalar(*keyframes: tuple) -> skia.Timeline:
+    timeline = skia.Timeline()
+    track = timeline.addTrack(skia.Timeline.TrackType.kScalar)
+    for time, value in keyframes:
+        timeline.addKeyframe(track, time, value)
+    return timeline
+
+
+def _at(timeline: skia.Timeline, t: float) -> float:
+    return timeline.evaluate(t)[0]
+
+
+def test_values_are_held_outside_the_keyframes() -> None:
+    timeline = _scalar((1, 10), (2, 20))
+    assert _at(timeline, 0) == 10
+    assert _at(timeline, 1.5) == pytest.approx(15)
+    assert _at(timeline, 3) == 20
+
+
+def test_keyframes_are_sorted_by_time() -> None:
+    timeline = _scalar((2, 20), (0, 0), (1, 10))
+    assert _at(timeline, 0.5) == pytest.approx(5)
+    assert _at(timeline, 1.5) == pytest.approx(15)
+    assert timeline.duration() == 2
+
+
+def test_duplicate_times_jump() -> None:
+    timeline = _scalar((0, 0), (1, 10), (1, 20), (2, 30))
+    assert _at(timeline, 0.5) == pytest.approx(5)
+    assert _at(timeline, 1 - 1e-4) == pytest.approx(10, abs=1e-2)
+    assert _at(timeline, 1) == 20
+    assert _at(timeline, 1.5) == pytest.approx(25)
+    assert _at(timeline, 2) == 30
+
+
+def test_duplicate_times_keep_insertion_order() -> None:
+    timeline = _scalar((0, 0), (1, 20), (1, 10), (2, 30))
+    assert _at(timeline, 1 - 1e-4) == pytest.approx(20, abs=1e-2)
+    assert _at(timeline, 1) == 10
+    assert _at(timeline, 1.5) == pytest.approx(20)
+
+
+def test_track_without_keyframes_is_none() -> None:
+    timeline = skia.Timeline()
+    timeline.addTrack(skia.Timeline.TrackType.kPoint)
+    assert timeline.evaluate(0) == [None]
+
+
+def test_class_example() -> None:
+    circle = Circle(10)
+    timeline = Timeline()
+    timeline.add(circle, 'pos', (0, (100, 100)), (2, (400, 100), easing.quad_inout))
+    timeline.add(circle, 'r', (0, 10), (1, 50, easing.back_out))
+    timeline.add(circle.style.set_fill_color, None, (0, 'red'), (2, 'blue'), space=ColorSpace.kOKLab)
+    assert timeline.duration == 2
+
+    timeline.apply(1)
+    assert circle.pos == skia.Point(250, 100)
+    assert circle.r == pytest.approx(50)
+    mid = circle.style.fill_paint.getColor4f()
+    assert 0 < mid.fR < 1 and 0 < mid.fB < 1
+
+    timeline.apply(2)
+    assert circle.pos == skia.Point(400, 100)
+    end = circle.style.fill_paint.getColor4f()
+    assert (end.fR, end.fG, end.fB, end.fA) == pytest.approx((0, 0, 1, 1), abs=1e-3)